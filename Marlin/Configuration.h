@@ -1633,6 +1633,23 @@
 #define MULTIPLE_PROBING 2    // Use a value of (0) with ProUIex, otherwise (2)
 //#define EXTRA_PROBING    1
 
+/**
+ * Bump Sampling
+ *
+ * Find the bed with one fast probe, then take all MULTIPLE_PROBING (+ EXTRA_PROBING)
+ * slow samples with only a short bump between them instead of a full raise to
+ * Z_CLEARANCE_MULTI_PROBE. The point is measured as the average of the samples
+ * nearest the median. If the samples spread more than PROBE_BUMP_MAX_STDDEV the
+ * point is sampled again with the full raise.
+ *
+ * The spread of each mesh point is shown by 'G29 V3' and in the mesh viewer.
+ */
+//#define PROBE_BUMP_SAMPLING
+#if ENABLED(PROBE_BUMP_SAMPLING)
+  #define PROBE_BUMP_MM           1.0   // (mm) Raise between samples. BLTouch needs room to re-deploy.
+  #define PROBE_BUMP_MAX_STDDEV   0.01  // (mm) Sample again with the full raise above this spread
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -2013,6 +2030,13 @@
 #define RESTORE_LEVELING_AFTER_G28
 //#define ENABLE_LEVELING_AFTER_G28
 
+/**
+ * Probe the grid in the order with the least XY travel from where the probe
+ * starts, and report the estimated time saved over the default order.
+ * Applies to G29 with Bilinear, Linear, Mesh and Unified Bed Leveling.
+ */
+//#define OPTIMIZE_PROBE_ORDER
+
 /**
  * Auto-leveling needs preheating
  */
@@ -2067,6 +2091,7 @@
    */
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
+  //#define LEVELED_SEGMENT_CELLS     // Bilinear/MBL: Split only where moves cross mesh cell edges, for fewer planner blocks
 
   /**
    * Enable the G26 Mesh Validation Pattern tool.
@@ -2348,6 +2373,13 @@
 #if ENABLED(EEPROM_SETTINGS)
   #define EEPROM_AUTO_INIT    // Init EEPROM automatically on any errors  // Ender Configs
   #define EEPROM_INIT_NOW     // Init EEPROM on first boot after a new build  // MRiscoC Reset EEPROM on first boot
+  //#define EEPROM_STAGED_IO    // Save and load settings in one block through a RAM copy. Uses RAM equal to the settings size.
+  //#define FLASH_EEPROM_LOG    // STM32F0/F1/F3 FLASH_EEPROM_EMULATION: Append only the changes on save, erasing flash only when the log is full.
+  #if ENABLED(FLASH_EEPROM_LOG)
+    // The log takes 2 x FLASH_EEPROM_LOG_PAGES pages at the end of flash. (16K with the defaults for a 2K EEPROM and 2K pages.)
+    // This space is not reserved for the build, so the firmware must be at least that much smaller than the flash.
+    //#define FLASH_EEPROM_LOG_PAGES 4  // Flash pages for each of the two log areas at the end of flash. Default: room for 4 copies of the EEPROM.
+  #endif
 #endif
 
 // @section host
@@ -3352,6 +3384,7 @@
   #define TFT_FONT  NOTOSANS
 
   //#define TFT_SHARED_IO   // I/O is shared between TFT display and other devices. Disable async data transfer.
+  //#define TFT_FRAME_TIME  // Report the average and maximum time spent drawing each screen update
 #endif
 
 #if ENABLED(TFT_LVGL_UI)
@@ -3424,6 +3457,7 @@
   #define MEDIASORT_MENU_ITEM   // Menu item: enable/disable file list sorting (104 bytes of flash)
   #define ENC_MENU_ITEM         // Menu item: faster/slower encoder rate (272 bytes of flash)
   #define SHOW_SPEED_IND        // Menu item: blink speed in mm/s along with speed percentage (296 bytes of flash)
+  //#define DWIN_TX_QUEUE_SIZE 512 // Coalesce display packets and send them in bulk. Report throughput with C576
   //#define NO_BLINK_IND        // Disables dashboard icon blink indicator highlighted background
 
 #endif
@@ -172,6 +172,14 @@
   #define REDUNDANT_SH_C_COEFF               0 // Steinhart-Hart C coefficient
 #endif
 
+// Convert custom thermistors with a RAM table, rebuilt when the parameters change (M305, M501).
+// Each custom sensor uses 2 bytes per entry, e.g., 1026 bytes with a 12-bit ADC and a step of 128.
+//#define USER_THERMISTOR_LUT_STEP 128 // (raw ADC units) Power of 2. Disable to evaluate the formula on every reading.
+
+// Index stock thermistor tables at build time so conversion starts at the right segment instead of bisecting.
+// Each table in use takes 1 byte of flash per step, e.g., 512 bytes with a 12-bit ADC and a step of 128.
+//#define THERMISTOR_LUT_STEP 128      // (raw ADC units) Power of 2. Disable to bisect the table on every reading.
+
 /**
  * Thermocouple Options — for MAX6675 (-2), MAX31855 (-3), and MAX31865 (-5).
  */
@@ -1152,6 +1160,11 @@
   // Try increasing this value if stepper motion is not smooth.
   #define FTM_STEPPERCMD_BUFF_SIZE 1000                 // Size of the stepper command buffers.
 
+  //#define FTM_FIXED_POINT                             // Generate and shape the trajectory with integer math in steps.
+                                                        // Aimed at MCUs without an FPU, such as STM32F1.
+  //#define FTM_COMPACT_BUFFERS                         // Pack each stepper command into one word and convert the
+                                                        // trajectory in place. Saves RAM on boards like STM32F103.
+
   //#define FT_MOTION_MENU                              // Provide a MarlinUI menu to set M493 parameters.
 #endif
 
@@ -1262,6 +1275,11 @@
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
 #define MINIMUM_PLANNER_SPEED 0.05 // (mm/s)
 
+// Use integer math for trapezoid steps and rates. Only the trapezoid is converted; the planner passes still
+// use float. Aimed at MCUs without an FPU (e.g., STM32F1), where it is not yet timed. Slower with an FPU.
+// Rates may differ by 1 step/s. Compare both paths with MARLIN_TEST_BUILD before enabling.
+//#define PLANNER_FIXED_POINT
+
 //
 // Backlash Compensation
 // Adds extra movement to axes on direction-changes to account for backlash.
@@ -1678,6 +1696,10 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls  // MRiscoC save program memory
 
+  // Read the printed file ahead in whole sectors instead of one byte at a time.
+  // Helps with files made of many tiny segments (arc-fitted, organic supports).
+  //#define SD_READAHEAD_SIZE 512             // (bytes) Multiple of 512, up to 4096. Uses as much SRAM.
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -1725,6 +1747,11 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Keep the recovery file open for the whole print and rotate saves through
+    // sector-sized slots, each with a sequence number and CRC. Every save is then
+    // a single SD block write and resume picks the newest intact slot.
+    //#define POWER_LOSS_JOURNAL_SLOTS 8 // Number of 512-byte slots (2-255)
+
     // Enable if Z homing is needed for proper recovery. 99.9% of the time this should be disabled!
     //#define POWER_LOSS_RECOVER_ZHOME
     #if ENABLED(POWER_LOSS_RECOVER_ZHOME)
@@ -1868,6 +1895,9 @@
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
     //#define CUSTOM_FIRMWARE_UPLOAD  // MRiscoC Enabled for easy firmware upgrade
+
+    // Largest heatshrink window a host may request. Larger windows compress better. (2^N bytes of RAM)
+    //#define BINARY_STREAM_MAX_WINDOW_BITS 10 // (4-15)
   #endif
 
   /**
@@ -2458,13 +2488,23 @@
   #define MAX_ARC_SEGMENT_MM      1.0 // (mm) Maximum length of each arc segment
   #define MIN_CIRCLE_SEGMENTS    72   // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50   // Use the feedrate to choose the segment length
+  //#define ARC_CHORD_TOLERANCE  10   // (µm) Use the radius to choose the segment length, keeping chords within this
+                                      // distance of the arc. Set with M214 T. T0 reverts to the segment lengths above.
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   #define ARC_P_CIRCLES               // Enable the 'P' parameter to specify complete circles  // MRiscoC Enabled
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
+  //#define ARC_NATIVE_BLOCKS         // Queue each arc as one planner block and trace its chords in the stepper ISR.
+                                      // Cartesian only. Adds 28 bytes to each planner block.
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    #define ARC_NATIVE_LEVELED_MM 5   // (mm) Longest arc block with bed leveling active, so Z can follow the mesh
+  #endif
 #endif
 
 // G5 Bézier Curve Support with XYZE destination and IJPQ offsets
 //#define BEZIER_CURVE_SUPPORT        // Requires ~2666 bytes
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #define BEZIER_TOLERANCE 0.01       // (mm) Largest distance between a curve and the chords that trace it
+#endif
 
 #if ANY(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   //#define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
@@ -4424,6 +4464,12 @@
    * To help diagnose print quality issues stemming from empty command buffers.
    */
   //#define BUFFER_MONITORING
+
+  /**
+   * D577 - Planner Statistics
+   * Count the planner pass kernels run for each queued block.
+   */
+  //#define PLANNER_STATISTICS
 #endif
 
 /**
@@ -113,7 +113,7 @@
   #else
     #error "LCD_SERIAL_PORT must be from 1 to 6, or -1 for Native USB."
   #endif
-  #if HAS_DGUS_LCD
+  #if ANY(HAS_DGUS_LCD, HAS_DWIN_TX_QUEUE)
     #define LCD_SERIAL_TX_BUFFER_FREE() LCD_SERIAL.availableForWrite()
   #endif
 #endif
@@ -26,7 +26,7 @@
 
 #include "../../inc/MarlinConfig.h"
 
-#if ENABLED(FLASH_EEPROM_EMULATION)
+#if ENABLED(FLASH_EEPROM_EMULATION) && DISABLED(FLASH_EEPROM_LOG)
 
 #include "../shared/eeprom_api.h"
 
@@ -244,6 +244,7 @@ bool PersistentStore::access_finish() {
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  crc16(crc, value, size);
   while (size--) {
     uint8_t v = *value;
     #if ENABLED(FLASH_EEPROM_LEVELING)
@@ -257,7 +258,6 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
         eeprom_data_written = true;
       }
     #endif
-    crc16(crc, &v, 1);
     pos++;
     value++;
   }
@@ -265,15 +265,22 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
 }
 
 bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
-  do {
-    const uint8_t c = TERN(FLASH_EEPROM_LEVELING, ram_eeprom[pos], eeprom_buffered_read_byte(pos));
-    if (writing) *value = c;
-    crc16(crc, &c, 1);
-    pos++;
-    value++;
-  } while (--size);
+  #if ENABLED(FLASH_EEPROM_LEVELING)
+    // Check the RAM copy in one block
+    crc16(crc, &ram_eeprom[pos], size);
+    if (writing) memcpy(value, &ram_eeprom[pos], size);
+    pos += size;
+  #else
+    do {
+      const uint8_t c = eeprom_buffered_read_byte(pos);
+      if (writing) *value = c;
+      crc16(crc, &c, 1);
+      pos++;
+      value++;
+    } while (--size);
+  #endif
   return false;
 }
 
-#endif // FLASH_EEPROM_EMULATION
+#endif // FLASH_EEPROM_EMULATION && !FLASH_EEPROM_LOG
 #endif // HAL_STM32
@@ -0,0 +1,451 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ * Copyright (c) 2015-2016 Nico Tonnhofer wurstnase.reprap@gmail.com
+ * Copyright (c) 2016 Victor Perez victor_pv@hotmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ALL(FLASH_EEPROM_EMULATION, FLASH_EEPROM_LOG)
+
+/**
+ * Log-structured flash EEPROM emulation for STM32F0, F1 and F3
+ *
+ * Two areas of FLASH_EEPROM_LOG_PAGES pages at the end of flash each hold a
+ * full EEPROM image followed by a log of changes. A save appends only the
+ * changed bytes as (offset, length, data) records, then a commit record. When
+ * the log is full the RAM copy is written as a new image into the other area,
+ * so pages are only erased once every many saves instead of on every save.
+ *
+ * Area layout:
+ *   area_header_t              Written last, so an area is valid only once its image is complete
+ *   image[MARLIN_EEPROM_SIZE]
+ *   record_t + data, ...       Records of one save, all with the same save number
+ *   record_t (commit)          Written last. Records without a commit are not replayed.
+ *   ...                        Up to the first erased record
+ */
+
+#include "../shared/eeprom_api.h"
+#include "stm32_def.h"
+
+// Use EEPROM.h for compatibility with the default flash emulation size
+#include <EEPROM.h>
+
+#define DEBUG_OUT ENABLED(EEPROM_CHITCHAT)
+#include "../../core/debug_out.h"
+
+#ifndef MARLIN_EEPROM_SIZE
+  #define MARLIN_EEPROM_SIZE size_t(E2END + 1)
+#endif
+
+#ifndef FLASH_EEPROM_LOG_PAGES
+  #define FLASH_EEPROM_LOG_PAGES ((4 * (MARLIN_EEPROM_SIZE) + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE)
+#endif
+
+#ifdef FLASH_BANK2_END
+  #define LOG_FLASH_END FLASH_BANK2_END
+#elif defined(FLASH_BANK1_END)
+  #define LOG_FLASH_END FLASH_BANK1_END
+#else
+  #define LOG_FLASH_END FLASH_END
+#endif
+
+typedef struct {
+  uint32_t magic, seq;          // Area in use, and its age. The newest valid area is loaded.
+} area_header_t;
+
+typedef struct {
+  uint16_t offset, length;      // Changed bytes, both multiples of 4. A commit has the record count and no data.
+  uint16_t crc;                 // Of the other fields and data, to reject a torn record
+  uint8_t save, tag;            // Save number in this area, and the record type. Written last.
+} record_t;
+
+constexpr uint32_t AREA_MAGIC = 0x4D4C4F47,   // "MLOG"
+                   AREA_SIZE = uint32_t(FLASH_EEPROM_LOG_PAGES) * FLASH_PAGE_SIZE,
+                   AREA_START = LOG_FLASH_END + 1 - 2 * AREA_SIZE,
+                   LOG_START = sizeof(area_header_t) + MARLIN_EEPROM_SIZE;
+constexpr uint8_t RECORD_TAG = 0x5A,           // Erased (0xFF) at the end of the log
+                  COMMIT_TAG = 0xC3;
+
+static_assert(0 == MARLIN_EEPROM_SIZE % 4, "MARLIN_EEPROM_SIZE must be a multiple of 4");
+static_assert(AREA_SIZE >= LOG_START + 4 * sizeof(record_t), "FLASH_EEPROM_LOG_PAGES is too small for MARLIN_EEPROM_SIZE.");
+
+static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4)));
+static uint32_t dirty[(MARLIN_EEPROM_SIZE / 4 + 31) / 32];  // Changed 4-byte units since the last save
+
+static bool loaded = false,
+            eeprom_data_written = false;
+static int8_t active_area = -1;  // -1 until the first save when flash holds no valid area
+static uint32_t active_seq = 0,
+                log_end;         // Offset of the next record in the active area
+static uint8_t log_save;         // Number of the next save in the active area
+
+#if ENABLED(MARLIN_TEST_BUILD)
+  // RAM stand-in for both areas while test_flash_eeprom_log() runs, so the real pages are never touched
+  static uint8_t test_flash[2 * AREA_SIZE] __attribute__((aligned(4)));
+  static bool test_active = false;
+  static int32_t test_cut = -1;     // Half-words programmed before a simulated power cut, or -1
+  static uint16_t test_erases;
+#endif
+
+static uint32_t area_address(const uint8_t area) {
+  return TERN(MARLIN_TEST_BUILD, (test_active ? uint32_t(uintptr_t(test_flash)) : AREA_START), AREA_START) + area * AREA_SIZE;
+}
+
+static void mark_dirty(const int pos) { const uint16_t u = pos / 4; SBI(dirty[u / 32], u % 32); }
+static bool is_dirty(const uint16_t u) { return TEST(dirty[u / 32], u % 32); }
+
+static uint16_t record_crc(const record_t &rec, const uint8_t *data) {
+  uint16_t crc = 0;
+  crc16(&crc, &rec.offset, sizeof(rec.offset));
+  crc16(&crc, &rec.length, sizeof(rec.length));
+  crc16(&crc, &rec.save, sizeof(rec.save));
+  crc16(&crc, &rec.tag, sizeof(rec.tag));
+  crc16(&crc, data, rec.length);
+  return crc;
+}
+
+// Find the next run of changed units from 'u', as [u, end). Runs one unit
+// apart are joined since a record header is larger than the unit in between.
+static bool next_run(uint16_t &u, uint16_t &end) {
+  constexpr uint16_t units = MARLIN_EEPROM_SIZE / 4;
+  while (u < units && !is_dirty(u)) ++u;
+  if (u >= units) return false;
+  end = u + 1;
+  while (end < units && (is_dirty(end) || (end + 1 < units && is_dirty(end + 1)))) ++end;
+  return true;
+}
+
+static bool program(uint32_t address, const void * const data, const uint32_t size) {
+  const uint8_t *src = (const uint8_t *)data;
+  for (uint32_t i = 0; i < size; i += 2, address += 2) {
+    uint16_t v;
+    memcpy(&v, &src[i], sizeof(v));
+    #if ENABLED(MARLIN_TEST_BUILD)
+      if (test_active) {
+        // Like flash, fail on a half-word that isn't erased
+        uint16_t * const p = (uint16_t *)address;
+        if (test_cut == 0 || *p != 0xFFFF) return false;
+        if (test_cut > 0) --test_cut;
+        *p = v;
+        continue;
+      }
+    #endif
+    const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, address, v);
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPGM("HAL_FLASH_Program=", status, " GetError=", HAL_FLASH_GetError(), " address=", address);
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Write the RAM copy as a new image into the other area
+ */
+static bool compact() {
+  const uint8_t area = active_area < 0 ? 0 : !active_area;
+  const uint32_t address = area_address(area);
+
+  FLASH_EraseInitTypeDef EraseInitStruct = { 0 };
+  EraseInitStruct.TypeErase = FLASH_TYPEERASE_PAGES;
+  EraseInitStruct.PageAddress = address;
+  EraseInitStruct.NbPages = FLASH_EEPROM_LOG_PAGES;
+  uint32_t PageError = 0;
+
+  #if ENABLED(MARLIN_TEST_BUILD)
+    if (test_active) {
+      if (test_cut == 0) return false;
+      memset((void *)address, 0xFF, AREA_SIZE);
+      ++test_erases;
+    }
+    else
+  #endif
+  {
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
+    hal.isr_off();
+    HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &PageError);
+    hal.isr_on();
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, RESUME_SERVO_OUTPUT());
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPGM("HAL_FLASHEx_Erase=", status, " GetError=", HAL_FLASH_GetError(), " PageError=", PageError);
+      return false;
+    }
+  }
+
+  const area_header_t header = { AREA_MAGIC, active_seq + 1 };
+  if (!program(address + sizeof(area_header_t), ram_eeprom, MARLIN_EEPROM_SIZE)
+    || !program(address, &header, sizeof(header))
+  ) return false;
+
+  active_area = area;
+  active_seq = header.seq;
+  log_end = LOG_START;
+  log_save = 0;
+  DEBUG_ECHOLNPGM("EEPROM image written to area ", area, ".");
+  return true;
+}
+
+/**
+ * Append a record of the current save. The caller has checked that it fits.
+ *   RECORD_TAG: The changed bytes [offset, offset + length)
+ *   COMMIT_TAG: The end of the save, with 'offset' records before it
+ */
+static bool append(const uint8_t tag, const uint16_t offset, const uint16_t length) {
+  const uint32_t address = area_address(active_area) + log_end;
+  const uint8_t * const data = &ram_eeprom[length ? offset : 0];
+  record_t rec = { offset, length, 0, log_save, tag };
+  rec.crc = record_crc(rec, data);
+  if (!program(address + sizeof(record_t), data, length)
+    || !program(address, &rec, sizeof(record_t))
+  ) {
+    log_end = AREA_SIZE;  // Partly programmed. Start a new image on the next save.
+    return false;
+  }
+
+  log_end += sizeof(record_t) + length;
+  return true;
+}
+
+/**
+ * Load the newest valid area and replay its log into the RAM copy
+ */
+static void load() {
+  active_area = -1;
+  for (uint8_t area = 0; area < 2; ++area) {
+    const area_header_t &header = *(const area_header_t *)area_address(area);
+    if (header.magic == AREA_MAGIC && (active_area < 0 || int32_t(header.seq - active_seq) > 0)) {
+      active_area = area;
+      active_seq = header.seq;
+    }
+  }
+
+  if (active_area < 0) {
+    memset(ram_eeprom, 0xFF, sizeof(ram_eeprom));
+    DEBUG_ECHOLNPGM("EEPROM log empty.");
+    return;
+  }
+
+  const uint32_t address = area_address(active_area);
+  memcpy(ram_eeprom, (const uint8_t *)(address + sizeof(area_header_t)), sizeof(ram_eeprom));
+
+  // Find the end of the last committed save, up to the first erased or bad record
+  uint16_t records = 0;
+  log_end = LOG_START;
+  log_save = 0;
+  for (uint32_t pos = LOG_START; pos + sizeof(record_t) <= AREA_SIZE;) {
+    const record_t &rec = *(const record_t *)(address + pos);
+    const bool commit = rec.tag == COMMIT_TAG;
+    if ((rec.tag != RECORD_TAG && !commit) || rec.save != log_save
+      || (commit ? (rec.length || rec.offset != records) : rec.offset + rec.length > MARLIN_EEPROM_SIZE)
+      || pos + sizeof(record_t) + rec.length > AREA_SIZE
+      || rec.crc != record_crc(rec, (const uint8_t *)(address + pos + sizeof(record_t)))
+    ) break;
+    pos += sizeof(record_t) + rec.length;
+    if (commit) { log_end = pos; records = 0; ++log_save; }
+    else ++records;
+  }
+
+  // Replay the committed saves
+  for (uint32_t pos = LOG_START; pos < log_end;) {
+    const record_t &rec = *(const record_t *)(address + pos);
+    if (rec.tag == RECORD_TAG) memcpy(&ram_eeprom[rec.offset], (const uint8_t *)(address + pos + sizeof(record_t)), rec.length);
+    pos += sizeof(record_t) + rec.length;
+  }
+
+  // Anything programmed after the last commit is from a save cut short by power
+  // loss or a program error. Don't append after it.
+  for (uint32_t i = log_end; i < AREA_SIZE; i += sizeof(uint32_t))
+    if (*(const uint32_t *)(address + i) != 0xFFFFFFFF) { log_end = AREA_SIZE; break; }
+
+  DEBUG_ECHOLNPGM("EEPROM loaded from area ", active_area, " with ", log_save, " saves.");
+}
+
+size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
+
+bool PersistentStore::access_start() {
+  EEPROM.begin(); // Avoid STM32 EEPROM.h warning (do nothing)
+  if (!loaded) { load(); loaded = true; }
+  return true;
+}
+
+bool PersistentStore::access_finish() {
+  if (!eeprom_data_written) return true;
+
+  HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPERR);
+
+  // Space for a record per run of changed units, and the commit record
+  uint16_t records = 0;
+  uint32_t size = sizeof(record_t);
+  for (uint16_t u = 0, end; next_run(u, end); u = end, ++records)
+    size += sizeof(record_t) + (end - u) * 4;
+
+  bool success;
+  if (active_area >= 0 && log_end + size <= AREA_SIZE) {
+    // Append the records, then commit them. A save without its commit is dropped on load.
+    success = true;
+    for (uint16_t u = 0, end; success && next_run(u, end); u = end)
+      success = append(RECORD_TAG, u * 4, (end - u) * 4);
+    if (success) success = append(COMMIT_TAG, records, 0);
+    if (success) ++log_save;
+  }
+  else
+    success = compact();  // Start a new image when the log is full
+
+  HAL_FLASH_Lock();
+
+  if (success) {
+    ZERO(dirty);
+    eeprom_data_written = false;
+  }
+  return success;
+}
+
+bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  crc16(crc, value, size);
+  while (size--) {
+    const uint8_t v = *value;
+    if (v != ram_eeprom[pos]) {
+      ram_eeprom[pos] = v;
+      mark_dirty(pos);
+      eeprom_data_written = true;
+    }
+    pos++;
+    value++;
+  }
+  return false;
+}
+
+bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  crc16(crc, &ram_eeprom[pos], size);
+  if (writing) memcpy(value, &ram_eeprom[pos], size);
+  pos += size;
+  return false;
+}
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  // Change a few separate runs of units, as M500 would, or the whole image (runs = 0), and save
+  static bool test_save(const uint16_t n, const uint8_t runs=3) {
+    persistentStore.access_start();
+    constexpr uint16_t units = MARLIN_EEPROM_SIZE / 4;
+    for (uint8_t i = 0; i < (runs ?: 1); ++i) {
+      const uint32_t v = uint32_t(n) << 8 | i;
+      int pos = runs ? (n * 97 + i * 331) % (units - 3) * 4 : 0;
+      for (uint16_t u = runs ? i + 1 : units; u--;) {
+        uint16_t crc = 0;
+        persistentStore.write_data(pos, (const uint8_t *)&v, sizeof(v), &crc);
+      }
+    }
+    return persistentStore.access_finish();
+  }
+
+  static uint16_t test_image_crc() {
+    uint16_t crc = 0;
+    crc16(&crc, ram_eeprom, sizeof(ram_eeprom));
+    return crc;
+  }
+
+  // Drop the RAM copy and load it again from flash
+  static void test_reboot() {
+    loaded = eeprom_data_written = false;
+    ZERO(dirty);
+    persistentStore.access_start();
+  }
+
+  /**
+   * Save through the log into a RAM stand-in for flash, rolling over both
+   * areas, and cut the power part way through appends and compactions.
+   * A save cut short must reload as the image from before it, and a
+   * complete save as the image after it.
+   */
+  void test_flash_eeprom_log() {
+    test_active = true;
+    test_cut = -1;
+    test_erases = 0;
+    memset(test_flash, 0xFF, sizeof(test_flash));
+    test_reboot();
+
+    uint16_t n = 0, fails = 0, cuts = 0;
+    auto check_reload = [&](const uint16_t crc) {
+      test_reboot();
+      if (test_image_crc() != crc) ++fails;
+    };
+
+    // Reload after every save until each area has been written twice
+    while (test_erases < 4 && n < 10000) {
+      if (!test_save(++n)) ++fails;
+      check_reload(test_image_crc());
+    }
+    if (test_erases < 4) ++fails;
+    const uint16_t saves = n;
+
+    // Stop programming after 'cut' half-words of a save, either as a program
+    // error or as a power cut followed by a reboot. Return 'true' if the save
+    // was done before the cut.
+    auto cut_save = [&](const int32_t cut, const uint8_t runs, const bool power_cut) {
+      const uint16_t before = test_image_crc();
+      test_cut = cut;
+      const bool done = test_save(++n, runs);
+      test_cut = -1;
+      if (!done) {
+        ++cuts;
+        // Not committed, so the whole save is dropped
+        if (power_cut) {
+          test_reboot();
+          if (test_image_crc() != before) ++fails;
+        }
+        // Nothing may be appended after a torn record, so the next save starts a new image
+        const uint16_t erases = test_erases;
+        if (!test_save(++n, runs) || ((cut || !power_cut) && test_erases == erases)) ++fails;
+      }
+      check_reload(test_image_crc());
+      return done;
+    };
+
+    // Torn records and commits of a multi-record save, with the log part way into an area
+    for (int32_t cut = 0; !cut_save(cut, 3, false); ++cut) { /* nada */ }
+    for (int32_t cut = 0; !cut_save(cut, 3, true); ++cut) { /* nada */ }
+
+    // Torn images and area headers, with the log full so the save compacts
+    constexpr int32_t compact_hw = (MARLIN_EEPROM_SIZE + sizeof(area_header_t)) / 2;
+    const int32_t compact_cuts[] = { 0, 1, compact_hw / 2, compact_hw - 4, compact_hw - 3, compact_hw - 2, compact_hw - 1 };
+    for (const int32_t cut : compact_cuts) {
+      while (log_end + 2 * sizeof(record_t) + MARLIN_EEPROM_SIZE <= AREA_SIZE)
+        if (!test_save(++n, 0)) { ++fails; break; }
+      if (cut_save(cut, 0, true)) ++fails;
+    }
+
+    // Leave the real pages to be loaded again on the next access
+    test_active = false;
+    loaded = eeprom_data_written = false;
+    ZERO(dirty);
+
+    SERIAL_ECHOLNPGM("Flash EEPROM log: ", saves, " saves, ", test_erases, " erases, ", cuts, " power cuts", fails ? " FAIL" : " PASS");
+  }
+
+#endif // MARLIN_TEST_BUILD
+
+#endif // FLASH_EEPROM_EMULATION && FLASH_EEPROM_LOG
+#endif // HAL_STM32
@@ -41,6 +41,16 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4 hardware."
 #endif
 
+#if ENABLED(FLASH_EEPROM_LOG)
+  #if DISABLED(FLASH_EEPROM_EMULATION)
+    #error "FLASH_EEPROM_LOG requires FLASH_EEPROM_EMULATION."
+  #elif ENABLED(FLASH_EEPROM_LEVELING)
+    #error "FLASH_EEPROM_LOG and FLASH_EEPROM_LEVELING cannot be used together."
+  #elif NOT_TARGET(STM32F0xx, STM32F1xx, STM32F3xx)
+    #error "FLASH_EEPROM_LOG is currently only supported on STM32F0, STM32F1 and STM32F3 hardware."
+  #endif
+#endif
+
 #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
   #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on STM32."
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
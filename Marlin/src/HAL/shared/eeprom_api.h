@@ -69,3 +69,7 @@ public:
 };
 
 extern PersistentStore persistentStore;
+
+#if ALL(MARLIN_TEST_BUILD, FLASH_EEPROM_EMULATION, FLASH_EEPROM_LOG)
+  void test_flash_eeprom_log();
+#endif
@@ -350,7 +350,10 @@ bool printingIsPaused() {
 void startOrResumeJob() {
   if (!printingIsPaused()) {
     TERN_(GCODE_REPEAT_MARKERS, repeat.reset());
-    TERN_(CANCEL_OBJECTS, cancelable.reset());
+    TERN_(CANCEL_OBJECTS, cancelable.reset(true));
+    #if ALL(HAS_MEDIA, CANCEL_OBJECTS)
+      queue.reset_canceled_skip();
+    #endif
     TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator = 0);
     #if ENABLED(SET_REMAINING_TIME)
       ui.reset_remaining_time();
@@ -45,8 +45,8 @@ xy_float_t LevelingBilinear::grid_factor;
 #else
   float LevelingBilinear::z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 #endif
-xy_pos_t LevelingBilinear::cached_rel;
 xy_int8_t LevelingBilinear::cached_g;
+LevelingBilinear::cell_coeff_t LevelingBilinear::cell_coeff[ABL_CELLS_X][ABL_CELLS_Y];
 
 /**
  * Extrapolate a single point from its neighbors
@@ -262,13 +262,6 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
 
 #endif // ABL_BILINEAR_SUBDIVISION
 
-// Refresh after other values have been updated
-void LevelingBilinear::refresh_bed_level() {
-  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
-  cached_rel.x = cached_rel.y = -999.999;
-  cached_g.x = cached_g.y = -99;
-}
-
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  grid_factor_virt.A
@@ -283,18 +276,37 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
-// Get the Z adjustment for non-linear bed leveling
-float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
-
-  static float z1, d2, z3, d4, L, D;
+/**
+ * Get the interpolation coefficients for every cell, so a lookup
+ * only has to find the cell and evaluate its polynomial.
+ */
+void LevelingBilinear::calc_cell_coeffs() {
+  for (uint8_t x = 0; x < ABL_BG_POINTS_X; ++x) {
+    const uint8_t nx = _MIN(x + 1, ABL_BG_POINTS_X - 1);
+    for (uint8_t y = 0; y < ABL_BG_POINTS_Y; ++y) {
+      const uint8_t ny = _MIN(y + 1, ABL_BG_POINTS_Y - 1);
+      const float z1 = ABL_BG_GRID(x, y),   // left-front
+                  z2 = ABL_BG_GRID(x, ny),  // left-back
+                  z3 = ABL_BG_GRID(nx, y),  // right-front
+                  z4 = ABL_BG_GRID(nx, ny); // right-back
+      cell_coeff[x][y] = { z1, z3 - z1, z2 - z1, z4 - z3 - z2 + z1 };
+    }
+  }
+}
 
-  static xy_pos_t ratio;
+// Refresh after other values have been updated
+void LevelingBilinear::refresh_bed_level() {
+  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
+  calc_cell_coeffs();
+  cached_g.x = cached_g.y = -99;
+}
 
-  // Whole units for the grid line indices. Constrained within bounds.
-  static xy_int8_t thisg, nextg;
+// Get the Z adjustment for non-linear bed leveling
+float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
-  // XY relative to the probed area
-  xy_pos_t rel = raw - grid_start.asFloat();
+  // XY relative to the probed area, in grid units
+  const xy_pos_t rel = raw - grid_start.asFloat();
+  const xy_float_t ratio = { rel.x * ABL_BG_FACTOR(x), rel.y * ABL_BG_FACTOR(y) };
 
   #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
     #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
@@ -302,70 +314,45 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
     #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
   #endif
 
-  if (cached_rel.x != rel.x) {
-    cached_rel.x = rel.x;
-    ratio.x = rel.x * ABL_BG_FACTOR(x);
-    const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
-    ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
+  // Consecutive segments usually stay within the last cell
+  float rx = ratio.x - cached_g.x, ry = ratio.y - cached_g.y;
+  if (!WITHIN(rx, 0, 1) || !WITHIN(ry, 0, 1)) {
+    // Whole units for the grid line indices. Constrained within bounds.
+    const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX)),
+                gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
+    cached_g.set(gx, gy);
+
+    // Subtract whole to get the ratio within the grid box
+    rx = ratio.x - gx;
+    ry = ratio.y - gy;
 
     #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
       // Beyond the grid maintain height at grid edges
-      NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
+      NOLESS(rx, 0); // Never < 0.0. (> 1.0 is ok in the flat cells past the far edge.)
+      NOLESS(ry, 0);
     #endif
-
-    thisg.x = gx;
-    nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
   }
 
-  if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
-
-    if (cached_rel.y != rel.y) {
-      cached_rel.y = rel.y;
-      ratio.y = rel.y * ABL_BG_FACTOR(y);
-      const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
-      ratio.y -= gy;
-
-      #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
-        // Beyond the grid maintain height at grid edges
-        NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
-      #endif
-
-      thisg.y = gy;
-      nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
-    }
-
-    if (cached_g != thisg) {
-      cached_g = thisg;
-      // Z at the box corners
-      z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
-      d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
-      z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
-      d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
-    }
+  // Bilinear interpolate
+  const cell_coeff_t &c = cell_coeff[cached_g.x][cached_g.y];
+  return c.a + c.b * rx + (c.c + c.d * rx) * ry;
+}
 
-    // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
-                L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
-    const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+#if HAS_LEVELED_CELL_SEGMENTS
 
-    D = R - L;
+  // Cell containing a position, limited to the (sub)grid
+  xy_uint8_t LevelingBilinear::cell_indexes(const xy_pos_t &raw) {
+    const xy_pos_t rel = raw - grid_start.asFloat();
+    return {
+      uint8_t(constrain(FLOOR(rel.x * ABL_BG_FACTOR(x)), 0, ABL_BG_POINTS_X - 2)),
+      uint8_t(constrain(FLOOR(rel.y * ABL_BG_FACTOR(y)), 0, ABL_BG_POINTS_Y - 2))
+    };
   }
 
-  const float offset = L + ratio.x * D;   // the offset almost always changes
+  float LevelingBilinear::get_cell_edge_x(const uint8_t i) { return grid_start.x + i * ABL_BG_SPACING(x); }
+  float LevelingBilinear::get_cell_edge_y(const uint8_t i) { return grid_start.y + i * ABL_BG_SPACING(y); }
 
-  /*
-  static float last_offset = 0;
-  if (ABS(last_offset - offset) > 0.2) {
-    SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
-    SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
-    SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
-    SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
-    SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
-  }
-  last_offset = offset;
-  //*/
-
-  return offset;
-}
+#endif
 
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
@@ -30,7 +30,6 @@ public:
 
 private:
   static xy_float_t grid_factor;
-  static xy_pos_t cached_rel;
   static xy_int8_t cached_g;
 //ProUI changed
   //static void extrapolate_one_point(const uint8_t x, const uint8_t y, const int8_t xdir, const int8_t ydir);
@@ -56,6 +55,23 @@ private:
     static void subdivide_mesh();
   #endif
 
+  #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+    #define ABL_CELLS_X ABL_GRID_POINTS_VIRT_X
+    #define ABL_CELLS_Y ABL_GRID_POINTS_VIRT_Y
+  #elif PROUI_EX
+    #define ABL_CELLS_X GRID_LIMIT
+    #define ABL_CELLS_Y GRID_LIMIT
+  #else
+    #define ABL_CELLS_X GRID_MAX_POINTS_X
+    #define ABL_CELLS_Y GRID_MAX_POINTS_Y
+  #endif
+
+  // z = a + b * x + c * y + d * x * y, with x and y as ratios within the cell.
+  // The last row and column are the flat cells used beyond the far edges.
+  typedef struct { float a, b, c, d; } cell_coeff_t;
+  static cell_coeff_t cell_coeff[ABL_CELLS_X][ABL_CELLS_Y];
+  static void calc_cell_coeffs();
+
 public:
   static void reset();
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
@@ -70,6 +86,12 @@ public:
   static float get_z_correction(const xy_pos_t &raw);
   static constexpr float get_z_offset() { return 0.0f; }
 
+  #if HAS_LEVELED_CELL_SEGMENTS
+    static xy_uint8_t cell_indexes(const xy_pos_t &raw);
+    static float get_cell_edge_x(const uint8_t i);
+    static float get_cell_edge_y(const uint8_t i);
+  #endif
+
   #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
     static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
   #endif
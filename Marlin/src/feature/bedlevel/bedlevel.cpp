@@ -35,6 +35,10 @@
   bool g29_in_progress = false;
 #endif
 
+#if HAS_PROBE_SPREAD
+  bed_mesh_t probe_spread;
+#endif
+
 #if ENABLED(LCD_BED_LEVELING)
   #include "../../lcd/marlinui.h"
 #endif
@@ -117,10 +121,22 @@ void reset_bed_level() {
   if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("reset_bed_level");
   IF_DISABLED(AUTO_BED_LEVELING_UBL, set_bed_leveling_enabled(false));
   TERN_(HAS_MESH, bedlevel.reset());
+  TERN_(HAS_PROBE_SPREAD, reset_probe_spread());
   TERN_(ABL_PLANAR, planner.bed_level_matrix.set_to_identity());
 }
 
-#if ANY(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
+#if HAS_PROBE_SPREAD
+
+  void reset_probe_spread() { GRID_LOOP(x, y) probe_spread[x][y] = NAN; }
+
+  void print_probe_spread() {
+    SERIAL_ECHOLNPGM("Probe sample standard deviation:");
+    print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 4, &probe_spread[0][0]);
+  }
+
+#endif
+
+#if ANY(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING, HAS_PROBE_SPREAD)
 
   /**
    * Enable to produce output in JSON format suitable
@@ -190,7 +206,7 @@ void reset_bed_level() {
     SERIAL_EOL();
   }
 
-#endif // AUTO_BED_LEVELING_BILINEAR || MESH_BED_LEVELING
+#endif // AUTO_BED_LEVELING_BILINEAR || MESH_BED_LEVELING || HAS_PROBE_SPREAD
 
 #if ANY(MESH_BED_LEVELING, PROBE_MANUALLY)
 
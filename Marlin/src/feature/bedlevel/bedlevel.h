@@ -73,7 +73,13 @@ class TemporaryBedLevelingState {
     #include "mbl/mesh_bed_leveling.h"
   #endif
 
-  #if ANY(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
+  #if HAS_PROBE_SPREAD
+    extern bed_mesh_t probe_spread;   // Standard deviation of the samples at each probed point
+    void reset_probe_spread();
+    void print_probe_spread();
+  #endif
+
+  #if ANY(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING, HAS_PROBE_SPREAD)
 
     #include <stdint.h>
 
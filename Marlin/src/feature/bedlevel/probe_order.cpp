@@ -0,0 +1,101 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(OPTIMIZE_PROBE_ORDER)
+
+#include "probe_order.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+
+xy_uint8_t ProbeOrder::size;
+xy_pos_t ProbeOrder::origin;
+xy_float_t ProbeOrder::spacing;
+ProbeOrder::skip_func_t ProbeOrder::skip;
+uint8_t ProbeOrder::best_sweep;
+
+void ProbeOrder::set_grid(const xy_uint8_t &_size, const xy_pos_t &_origin, const xy_float_t &_spacing, const skip_func_t _skip/*=nullptr*/) {
+  size = _size;
+  origin = _origin;
+  spacing = _spacing;
+  skip = _skip;
+  best_sweep = 0;
+}
+
+xy_uint8_t ProbeOrder::point(const uint8_t sweep, const grid_count_t index) {
+  const bool y_first = sweep & SWEEP_Y_FIRST;
+  const uint8_t inner_size = y_first ? size.y : size.x,
+                outer = index / inner_size;
+  uint8_t inner = index - grid_count_t(outer) * inner_size;
+  if (outer & 1) inner = inner_size - 1 - inner;  // Reverse every other row or column
+
+  xy_uint8_t pos;
+  if (y_first) pos.set(outer, inner); else pos.set(inner, outer);
+  if (sweep & SWEEP_FLIP_X) pos.x = size.x - 1 - pos.x;
+  if (sweep & SWEEP_FLIP_Y) pos.y = size.y - 1 - pos.y;
+  return pos;
+}
+
+/**
+ * Estimate one probe move as a trapezoid at the XY probe feedrate,
+ * or a triangle if the move is too short to reach that feedrate.
+ */
+void ProbeOrder::add_move(probe_travel_t &t, const xy_pos_t &from, const xy_pos_t &to) {
+  const float mm = (to - from).magnitude();
+  if (mm < 0.001f) return;
+  const float v = XY_PROBE_FEEDRATE_MM_S, a = planner.settings.travel_acceleration;
+  t.mm += mm;
+  t.sec += (mm * a < sq(v)) ? 2.0f * SQRT(mm / a) : mm / v + v / a;
+}
+
+probe_travel_t ProbeOrder::travel(const uint8_t sweep, const xy_pos_t &from) {
+  probe_travel_t t = { 0, 0 };
+  xy_pos_t last = from;
+  for (grid_count_t i = 0; i < points(); ++i) {
+    const xy_uint8_t pos = point(sweep, i);
+    if (skip && skip(pos)) continue;
+    const xy_pos_t next = position(pos);
+    add_move(t, last, next);
+    last = next;
+  }
+  return t;
+}
+
+probe_travel_t ProbeOrder::plan(const xy_pos_t &from) {
+  probe_travel_t best = travel(0, from);
+  best_sweep = 0;
+  for (uint8_t s = 1; s < SWEEP_COUNT; ++s) {
+    const probe_travel_t t = travel(s, from);
+    if (t.sec < best.sec) { best = t; best_sweep = s; }
+  }
+  return best;
+}
+
+void ProbeOrder::report(const probe_travel_t &before, const probe_travel_t &after) {
+  SERIAL_ECHOLNPGM(
+    "Probe path ", p_float_t(after.mm, 1), "mm, about ", p_float_t(after.sec, 1), "s"
+    " (", p_float_t(before.mm - after.mm, 1), "mm and ", p_float_t(before.sec - after.sec, 1), "s less than default)"
+  );
+}
+
+#endif // OPTIMIZE_PROBE_ORDER
@@ -0,0 +1,76 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Probe order planner
+ *
+ * Chooses the serpentine sweep of a probing grid with the least travel from
+ * the current probe position. There are eight sweeps: X or Y as the inner
+ * axis, starting from any of the four corners. On a full grid every step of
+ * a sweep moves to a neighbor, so the choice comes down to stepping along
+ * the closer spaced axis and starting near the probe. Every order raises Z
+ * once per point, so only the XY travel differs.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+typedef struct { float mm, sec; } probe_travel_t;
+
+class ProbeOrder {
+public:
+  typedef bool (*skip_func_t)(const xy_uint8_t &pos);
+
+  static constexpr uint8_t SWEEP_Y_FIRST = _BV(0),  // Inner axis is Y
+                           SWEEP_FLIP_X  = _BV(1),  // Start at the right
+                           SWEEP_FLIP_Y  = _BV(2),  // Start at the back
+                           SWEEP_COUNT   = 8;
+
+  // Set the grid to plan. Points for which 'skip' returns true are not visited.
+  static void set_grid(const xy_uint8_t &_size, const xy_pos_t &_origin, const xy_float_t &_spacing, const skip_func_t _skip=nullptr);
+
+  static grid_count_t points() { return grid_count_t(size.x) * size.y; }
+  static xy_pos_t position(const xy_uint8_t &pos) { return origin + spacing * pos.asFloat(); }
+
+  // Grid point visited at the given step of a sweep
+  static xy_uint8_t point(const uint8_t sweep, const grid_count_t index);
+  static xy_uint8_t point(const grid_count_t index) { return point(best_sweep, index); }
+
+  // Estimated travel to visit all points of a sweep, starting from a probe position
+  static probe_travel_t travel(const uint8_t sweep, const xy_pos_t &from);
+
+  // Choose the sweep with the least travel and return its estimate
+  static probe_travel_t plan(const xy_pos_t &from);
+
+  // Add one probe move to a travel estimate
+  static void add_move(probe_travel_t &t, const xy_pos_t &from, const xy_pos_t &to);
+
+  // Report the time saved over the default order
+  static void report(const probe_travel_t &before, const probe_travel_t &after);
+
+private:
+  static xy_uint8_t size;
+  static xy_pos_t origin;
+  static xy_float_t spacing;
+  static skip_func_t skip;
+  static uint8_t best_sweep;
+};
@@ -70,6 +70,13 @@ int8_t unified_bed_leveling::storage_slot;
   float unified_bed_leveling::z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 #endif
 
+#if PROUI_EX
+  unified_bed_leveling::cell_coeff_t unified_bed_leveling::cell_coeff[GRID_LIMIT][GRID_LIMIT];
+#else
+  unified_bed_leveling::cell_coeff_t unified_bed_leveling::cell_coeff[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+#endif
+xy_uint8_t unified_bed_leveling::cached_cell;
+
 #if DISABLED(PROUI_EX)
   #define _GRIDPOS(A,N) (MESH_MIN_##A + N * (MESH_##A##_DIST))
 
@@ -97,6 +104,7 @@ void unified_bed_leveling::reset() {
   set_bed_leveling_enabled(false);
   storage_slot = -1;
   ZERO(z_values);
+  refresh_bed_level();
   #if ENABLED(EXTENSIBLE_UI)
     GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
   #endif
@@ -113,6 +121,69 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
     z_values[x][y] = value;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, value));
   }
+  refresh_bed_level();
+}
+
+/**
+ * Get the interpolation coefficients for one cell. Motion replaces
+ * undefined points with zero, while lookups let the NAN propagate.
+ */
+unified_bed_leveling::cell_coeff_t unified_bed_leveling::calc_cell_coeff(const uint8_t x, const uint8_t y, const bool nan_as_zero/*=false*/) {
+  const uint8_t nx = _MIN(x + 1, (GRID_MAX_POINTS_X) - 1),
+                ny = _MIN(y + 1, (GRID_MAX_POINTS_Y) - 1);
+  float z1 = z_values[x][y],   // left-front
+        z2 = z_values[x][ny],  // left-back
+        z3 = z_values[nx][y],  // right-front
+        z4 = z_values[nx][ny]; // right-back
+  if (nan_as_zero) {
+    if (isnan(z1)) z1 = 0;
+    if (isnan(z2)) z2 = 0;
+    if (isnan(z3)) z3 = 0;
+    if (isnan(z4)) z4 = 0;
+  }
+  return { z1, z3 - z1, z2 - z1, z4 - z3 - z2 + z1 };
+}
+
+// Refresh after the mesh has been edited, loaded, or tilted
+void unified_bed_leveling::refresh_bed_level() {
+  GRID_LOOP(x, y) cell_coeff[x][y] = calc_cell_coeff(x, y);
+  cached_cell.reset();
+}
+
+float unified_bed_leveling::get_z_correction(const_float_t rx0, const_float_t ry0) {
+  /**
+   * Check if the requested location is off the mesh.  If so, and
+   * UBL_Z_RAISE_WHEN_OFF_MESH is specified, that value is returned.
+   */
+  #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
+    if (!WITHIN(rx0, MESH_MIN_X, MESH_MAX_X) || !WITHIN(ry0, MESH_MIN_Y, MESH_MAX_Y))
+      return UBL_Z_RAISE_WHEN_OFF_MESH;
+  #endif
+
+  // Consecutive lookups usually stay within the last cell
+  float rx = (rx0 - get_mesh_x(cached_cell.x)) * RECIPROCAL(MESH_X_DIST),
+        ry = (ry0 - get_mesh_y(cached_cell.y)) * RECIPROCAL(MESH_Y_DIST);
+  if (!WITHIN(rx, 0, 1) || !WITHIN(ry, 0, 1)) {
+    cached_cell = cell_indexes(rx0, ry0); // return values are clamped
+    rx = (rx0 - get_mesh_x(cached_cell.x)) * RECIPROCAL(MESH_X_DIST);
+    ry = (ry0 - get_mesh_y(cached_cell.y)) * RECIPROCAL(MESH_Y_DIST);
+  }
+
+  float z0 = cell_coeff[cached_cell.x][cached_cell.y].z(rx, ry);
+
+  if (isnan(z0)) { // If part of the Mesh is undefined, it will show up as NAN
+    z0 = 0.0;      // in z_values[][] and propagate through the calculations.
+                   // If our correction is NAN, we throw it out because part of
+                   // the Mesh is undefined and we don't have the information
+                   // needed to complete the height correction.
+
+    if (DEBUGGING(MESH_ADJUST)) DEBUG_ECHOLNPGM("??? Yikes! NAN in ");
+  }
+
+  if (DEBUGGING(MESH_ADJUST))
+    DEBUG_ECHOLN(F("get_z_correction("), rx0, F(", "), ry0, F(") => "), p_float_t(z0, 6));
+
+  return z0;
 }
 
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
@@ -70,6 +70,20 @@ private:
 
   static G29_parameters_t param;
 
+  // z = a + b * x + c * y + d * x * y, with x and y as ratios within the cell.
+  // The last row and column are the flat cells used beyond the far edges.
+  typedef struct {
+    float a, b, c, d;
+    float z(const_float_t rx, const_float_t ry) const { return a + b * rx + (c + d * rx) * ry; }
+  } cell_coeff_t;
+  #if PROUI_EX
+    static cell_coeff_t cell_coeff[GRID_LIMIT][GRID_LIMIT];
+  #else
+    static cell_coeff_t cell_coeff[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+  #endif
+  static xy_uint8_t cached_cell;
+  static cell_coeff_t calc_cell_coeff(const uint8_t x, const uint8_t y, const bool nan_as_zero=false);
+
   #if IS_NEWPANEL
     static void move_z_with_encoder(const_float_t multiplier);
     static float measure_point_with_encoder();
@@ -116,6 +130,7 @@ public:
   static int8_t storage_slot;
 
   static bed_mesh_t z_values;
+  static void refresh_bed_level();  // Call after changing z_values
   #if ENABLED(OPTIMIZED_MESH_STORAGE)
     static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
     static void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
@@ -252,43 +267,10 @@ public:
   }
 
   /**
-   * This is the generic Z-Correction. It works anywhere within a Mesh Cell. It first
-   * does a linear interpolation along both of the bounding X-Mesh-Lines to find the
-   * Z-Height at both ends. Then it does a linear interpolation of these heights based
-   * on the Y position within the cell.
+   * This is the generic Z-Correction. It works anywhere within a Mesh Cell,
+   * evaluating the cached bilinear coefficients of the cell.
    */
-  static float get_z_correction(const_float_t rx0, const_float_t ry0) {
-    const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
-
-    /**
-     * Check if the requested location is off the mesh.  If so, and
-     * UBL_Z_RAISE_WHEN_OFF_MESH is specified, that value is returned.
-     */
-    #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
-      if (!WITHIN(rx0, MESH_MIN_X, MESH_MAX_X) || !WITHIN(ry0, MESH_MIN_Y, MESH_MAX_Y))
-        return UBL_Z_RAISE_WHEN_OFF_MESH;
-    #endif
-
-    const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1;
-    const float x0 = get_mesh_x(cx), x1 = get_mesh_x(cx + 1),
-                z1 = calc_z0(rx0, x0, z_values[cx][cy], x1, z_values[mx][cy]),
-                z2 = calc_z0(rx0, x0, z_values[cx][my], x1, z_values[mx][my]);
-    float z0 = calc_z0(ry0, get_mesh_y(cy), z1, get_mesh_y(cy + 1), z2);
-
-    if (isnan(z0)) { // If part of the Mesh is undefined, it will show up as NAN
-      z0 = 0.0;      // in z_values[][] and propagate through the calculations.
-                     // If our correction is NAN, we throw it out because part of
-                     // the Mesh is undefined and we don't have the information
-                     // needed to complete the height correction.
-
-      if (DEBUGGING(MESH_ADJUST)) DEBUG_ECHOLNPGM("??? Yikes! NAN in ");
-    }
-
-    if (DEBUGGING(MESH_ADJUST))
-      DEBUG_ECHOLN(F("get_z_correction("), rx0, F(", "), ry0, F(") => "), p_float_t(z0, 6));
-
-    return z0;
-  }
+  static float get_z_correction(const_float_t rx0, const_float_t ry0);
   static float get_z_correction(const xy_pos_t &pos) { return get_z_correction(pos.x, pos.y); }
 
   static constexpr float get_z_offset() { return 0.0f; }
@@ -52,6 +52,10 @@
   #include "../hilbert_curve.h"
 #endif
 
+#if ENABLED(OPTIMIZE_PROBE_ORDER)
+  #include "../probe_order.h"
+#endif
+
 #include <math.h>
 
 #define UBL_G29_P31
@@ -467,6 +471,7 @@ void unified_bed_leveling::G29() {
           if (param.V_verbosity > 1)
             SERIAL_ECHOLN(F("Probing around ("), param.XY_pos.x, AS_CHAR(','), param.XY_pos.y, F(").\n"));
           probe_entire_mesh(param.XY_pos, parser.seen_test('T'), parser.seen_test('E'), parser.seen_test('U'));
+          TERN_(HAS_PROBE_SPREAD, if (param.V_verbosity > 2) print_probe_spread());
 
           report_current_position();
           probe_deployed = true;
@@ -749,6 +754,34 @@ void unified_bed_leveling::shift_mesh_height() {
 }
 
 #if HAS_BED_PROBE
+
+  #if ENABLED(OPTIMIZE_PROBE_ORDER)
+
+    // Points that are already valid or out of reach are left out of the plan
+    static bool skip_for_probing(const xy_uint8_t &pos) {
+      return !isnan(bedlevel.z_values[pos.x][pos.y]) || !probe.can_reach(ProbeOrder::position(pos));
+    }
+
+    // Estimate the travel of the closest-point search to compare with the planned order
+    static probe_travel_t closest_search_travel(const xy_pos_t &nearby, xy_pos_t from) {
+      MeshFlags done;
+      done.reset();
+      GRID_LOOP(x, y) if (!isnan(bedlevel.z_values[x][y])) done.mark(x, y);
+
+      probe_travel_t t = { 0, 0 };
+      for (;;) {
+        mesh_index_pair best = bedlevel.find_closest_mesh_point_of_type(SET_IN_BITMAP, nearby, true, &done);
+        if (!best.valid()) break;
+        const xy_pos_t to = best.meshpos();
+        ProbeOrder::add_move(t, from, to);
+        from = to;
+        done.mark(best.pos);
+      }
+      return t;
+    }
+
+  #endif
+
   /**
    * G29 P1 T<maptype> V<verbosity> : Probe Entire Mesh
    *   Probe all invalidated locations of the mesh that can be reached by the probe.
@@ -764,6 +797,25 @@ void unified_bed_leveling::shift_mesh_height() {
     save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
     grid_count_t count = GRID_MAX_POINTS;
 
+    TERN_(HAS_PROBE_SPREAD, GRID_LOOP(x, y) if (isnan(z_values[x][y])) probe_spread[x][y] = NAN);
+
+    #if ENABLED(OPTIMIZE_PROBE_ORDER)
+      // Follow the planned sweep if it moves less than the closest-point search
+      grid_count_t plan_index = 0;
+      bool use_plan = false;
+      if (!do_furthest) {
+        const xy_uint8_t size = { GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y };
+        const xy_pos_t origin = { get_mesh_x(0), get_mesh_y(0) };
+        const xy_float_t spacing = { MESH_X_DIST, MESH_Y_DIST };
+        ProbeOrder::set_grid(size, origin, spacing, skip_for_probing);
+        const xy_pos_t probe_xy = current_position + probe.offset_xy;
+        const probe_travel_t before = closest_search_travel(nearby, probe_xy),
+                             after = ProbeOrder::plan(probe_xy);
+        use_plan = after.sec < before.sec;
+        ProbeOrder::report(before, use_plan ? after : before);
+      }
+    #endif
+
     mesh_index_pair best;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_START));
     do {
@@ -788,14 +840,25 @@ void unified_bed_leveling::shift_mesh_height() {
 
       TERN_(PROUI_EX, if (ProEx.QuitLeveling()) return DWIN_LevelingDone(););
 
-      best = do_furthest
-        ? find_furthest_invalid_mesh_point()
-        : find_closest_mesh_point_of_type(INVALID, nearby, true);
+      #if ENABLED(OPTIMIZE_PROBE_ORDER)
+        if (use_plan) {
+          best.invalidate();
+          while (plan_index < ProbeOrder::points()) {
+            const xy_uint8_t pos = ProbeOrder::point(plan_index++);
+            if (!skip_for_probing(pos)) { best.pos.set(pos.x, pos.y); break; }
+          }
+        }
+        else
+      #endif
+          best = do_furthest
+            ? find_furthest_invalid_mesh_point()
+            : find_closest_mesh_point_of_type(INVALID, nearby, true);
 
       if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_START));
         const float measured_z = probe.probe_at_point(best.meshpos(), stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, param.V_verbosity);
         z_values[best.pos.x][best.pos.y] = measured_z;
+        TERN_(HAS_PROBE_SPREAD, probe_spread[best.pos.x][best.pos.y] = probe.sample_stats.stddev);
         #if ENABLED(EXTENSIBLE_UI)
           ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_FINISH);
           ExtUI::onMeshUpdate(best.pos, measured_z);
@@ -1489,6 +1552,10 @@ bool unified_bed_leveling::smart_fill_one(const uint8_t x, const uint8_t y, cons
 
   void unified_bed_leveling::tilt_mesh_based_on_probed_grid(const bool do_3_pt_leveling) {
 
+    // The probed points are corrected with get_z_correction, so bring the cells up to date with
+    // any probing or edits done earlier in this G29
+    refresh_bed_level();
+
     float measured_z;
     bool abort_flag = false;
 
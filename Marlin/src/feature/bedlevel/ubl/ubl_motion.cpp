@@ -86,12 +86,10 @@
 
       // The distance is always MESH_X_DIST so multiply by the constant reciprocal.
       const float xratio = (end.x - get_mesh_x(iend.x)) * RECIPROCAL(MESH_X_DIST),
-                  yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST),
-                  z1 = z_values[iend.x][iend.y    ] + xratio * (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
-                  z2 = z_values[iend.x][iend.y + 1] + xratio * (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
+                  yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST);
 
-      // X cell-fraction done. Interpolate the two Z offsets with the Y fraction for the final Z offset.
-      const float z0 = (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end.z);
+      // Evaluate the cached cell coefficients for the final Z offset.
+      const float z0 = cell_coeff[iend.x][iend.y].z(xratio, yratio) * planner.fade_scaling_factor_for_z(end.z);
 
       // Undefined parts of the Mesh in z_values[][] are NAN.
       // Replace NAN corrections with 0.0 to prevent NAN propagation.
@@ -421,30 +419,20 @@
       LIMIT(icell.x, 0, GRID_MAX_CELLS_X);
       LIMIT(icell.y, 0, GRID_MAX_CELLS_Y);
 
-      const int8_t ncellx = _MIN(icell.x+1, GRID_MAX_CELLS_X),
-                   ncelly = _MIN(icell.y+1, GRID_MAX_CELLS_Y);
-      float z_x0y0 = z_values[icell.x][icell.y],  // z at lower left corner
-            z_x1y0 = z_values[ncellx ][icell.y],  // z at upper left corner
-            z_x0y1 = z_values[icell.x][ncelly ],  // z at lower right corner
-            z_x1y1 = z_values[ncellx ][ncelly ];  // z at upper right corner
-
-      if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
-      if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
-      if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
-      if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
+      // Cached coefficients for the cell. Undefined mesh points come through as NAN, so
+      // ideally activating planner.leveling_active (G29 A) should refuse if any invalid
+      // mesh points exist. Until then, guess zero for undefined points.
+      cell_coeff_t cc = cell_coeff[icell.x][icell.y];
+      if (isnan(cc.a + cc.b + cc.c + cc.d)) cc = calc_cell_coeff(icell.x, icell.y, true);
 
       const xy_pos_t pos = { get_mesh_x(icell.x), get_mesh_y(icell.y) };
       xy_pos_t cell = raw - pos;
 
-      const float z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST),   // z slope per x along y0 (lower left to lower right)
-                  z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);   // z slope per x along y1 (upper left to upper right)
-
-            float z_cxy0 = z_x0y0 + z_xmy0 * cell.x;        // z height along y0 at cell.x (changes for each cell.x in cell)
-
-      const float z_cxy1 = z_x0y1 + z_xmy1 * cell.x,        // z height along y1 at cell.x
-                  z_cxyd = z_cxy1 - z_cxy0;                 // z height difference along cell.x from y0 to y1
+      const float z_xmy0 = cc.b * RECIPROCAL(MESH_X_DIST),  // z slope per x along y0 (lower left to lower right)
+                  z_xmyd = cc.d * RECIPROCAL(MESH_X_DIST);  // z slope difference per x from y0 to y1
 
-            float z_cxym = z_cxyd * RECIPROCAL(MESH_Y_DIST); // z slope per y along cell.x from pos.y to y1 (changes for each cell.x in cell)
+            float z_cxy0 = cc.a + z_xmy0 * cell.x,          // z height along y0 at cell.x (changes for each cell.x in cell)
+                  z_cxym = (cc.c + z_xmyd * cell.x) * RECIPROCAL(MESH_Y_DIST); // z slope per y along cell.x from pos.y to y1 (changes for each cell.x in cell)
 
       //    float z_cxcy = z_cxy0 + z_cxym * cell.y;        // interpolated mesh z height along cell.x at cell.y (do inside the segment loop)
 
@@ -452,8 +440,8 @@
       // and the z_cxym slope will change, both as a function of cell.x within the cell, and
       // each change by a constant for fixed segment lengths.
 
-      const float z_sxy0 = z_xmy0 * diff.x,                                       // per-segment adjustment to z_cxy0
-                  z_sxym = (z_xmy1 - z_xmy0) * RECIPROCAL(MESH_Y_DIST) * diff.x;  // per-segment adjustment to z_cxym
+      const float z_sxy0 = z_xmy0 * diff.x,                               // per-segment adjustment to z_cxy0
+                  z_sxym = z_xmyd * RECIPROCAL(MESH_Y_DIST) * diff.x;     // per-segment adjustment to z_cxym
 
       for (;;) {  // for all segments within this mesh cell
 
@@ -31,6 +31,17 @@ char* SDFileTransferProtocol::Packet::Open::data = nullptr;
 size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
 
+#if ENABLED(BINARY_STREAM_COMPRESSION)
+  uint8_t SDFileTransferProtocol::window_bits = HEATSHRINK_STATIC_WINDOW_BITS,
+          SDFileTransferProtocol::lookahead_bits = HEATSHRINK_STATIC_LOOKAHEAD_BITS;
+#endif
+
+#if ENABLED(MARLIN_TEST_BUILD)
+  const bs_test_source_t *bs_test_source; // = nullptr
+  uint32_t SDFileTransferProtocol::sector_writes, SDFileTransferProtocol::partial_writes;
+  uint16_t SDFileTransferProtocol::written_crc;
+#endif
+
 BinaryStream binaryStream[NUM_SERIAL];
 
 #endif
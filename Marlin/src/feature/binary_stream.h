@@ -23,19 +23,38 @@
 
 #include "../inc/MarlinConfig.h"
 
+// STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA.
+// All file data is coalesced here so the card only ever gets whole-sector writes.
+static __attribute__((aligned(sizeof(size_t)))) uint8_t sector_buffer[512] = {};
+
 #define BINARY_STREAM_COMPRESSION
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   #include "../libs/heatshrink/heatshrink_decoder.h"
-  // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
-  static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[512] = {};
   static heatshrink_decoder hsd;
 #endif
 
+#if ENABLED(MARLIN_TEST_BUILD)
+  #include "../libs/crc16.h"
+
+  // Tests can feed the stream from memory instead of a serial port
+  typedef struct {
+    bool (*available)();
+    int (*read)();
+  } bs_test_source_t;
+  extern const bs_test_source_t *bs_test_source;
+#endif
+
 inline bool bs_serial_data_available(const serial_index_t index) {
+  #if ENABLED(MARLIN_TEST_BUILD)
+    if (bs_test_source) return bs_test_source->available();
+  #endif
   return SERIAL_IMPL.available(index);
 }
 
 inline int bs_read_serial(const serial_index_t index) {
+  #if ENABLED(MARLIN_TEST_BUILD)
+    if (bs_test_source) return bs_test_source->read();
+  #endif
   return SERIAL_IMPL.read(index);
 }
 
@@ -67,7 +86,22 @@ private:
     }
     transfer_active = true;
     data_waiting = 0;
-    TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_reset(&hsd));
+    #if ENABLED(MARLIN_TEST_BUILD)
+      sector_writes = partial_writes = 0;
+      written_crc = 0;
+    #endif
+    TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_configure(&hsd, window_bits, lookahead_bits));
+    return true;
+  }
+
+  // Write out the sector buffer. Only the last write of a file may be partial.
+  static bool flush_sector() {
+    if (!dummy_transfer && card.write(sector_buffer, data_waiting) < 0) return false;
+    #if ENABLED(MARLIN_TEST_BUILD)
+      if (data_waiting == sizeof(sector_buffer)) sector_writes++; else partial_writes++;
+      crc16(&written_crc, sector_buffer, data_waiting);
+    #endif
+    data_waiting = 0;
     return true;
   }
 
@@ -81,32 +115,28 @@ private:
           heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
           total_processed += processed_count;
           do {
-            presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
+            presult = heatshrink_decoder_poll(&hsd, &sector_buffer[data_waiting], sizeof(sector_buffer) - data_waiting, &processed_count);
             data_waiting += processed_count;
-            if (data_waiting == sizeof(decode_buffer)) {
-              if (!dummy_transfer)
-                if (card.write(decode_buffer, data_waiting) < 0) {
-                  return false;
-                }
-              data_waiting = 0;
-            }
+            if (data_waiting == sizeof(sector_buffer) && !flush_sector()) return false;
           } while (presult == HSDR_POLL_MORE);
         }
         return true;
       }
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
+    for (size_t total_processed = 0; total_processed < length;) {
+      const size_t count = _MIN(length - total_processed, sizeof(sector_buffer) - data_waiting);
+      memcpy(&sector_buffer[data_waiting], &buffer[total_processed], count);
+      data_waiting += count;
+      total_processed += count;
+      if (data_waiting == sizeof(sector_buffer) && !flush_sector()) return false;
+    }
+    return true;
   }
 
   static bool file_close() {
+    // flush any buffered data
+    if (data_waiting && !flush_sector()) return false;
     if (!dummy_transfer) {
-      #if ENABLED(BINARY_STREAM_COMPRESSION)
-        // flush any buffered data
-        if (data_waiting) {
-          if (card.write(decode_buffer, data_waiting) < 0) return false;
-          data_waiting = 0;
-        }
-      #endif
       card.closefile();
       card.release();
     }
@@ -116,6 +146,7 @@ private:
   }
 
   static void transfer_abort() {
+    data_waiting = 0;
     if (!dummy_transfer) {
       card.closefile();
       card.removeFile(card.filename);
@@ -131,8 +162,23 @@ private:
   static size_t data_waiting, transfer_timeout, idle_timeout;
   static bool transfer_active, dummy_transfer, compression;
 
+  #if ENABLED(BINARY_STREAM_COMPRESSION)
+    static uint8_t window_bits, lookahead_bits;   // Negotiated at QUERY time
+
+    // Accept the host's requested sizes, limited to what the decoder buffer holds
+    static void negotiate(const uint8_t window, const uint8_t lookahead) {
+      window_bits = constrain(window, HEATSHRINK_MIN_WINDOW_BITS, HEATSHRINK_STATIC_WINDOW_BITS);
+      lookahead_bits = constrain(lookahead, HEATSHRINK_MIN_LOOKAHEAD_BITS, window_bits - 1);
+    }
+  #endif
+
 public:
 
+  #if ENABLED(MARLIN_TEST_BUILD)
+    static uint32_t sector_writes, partial_writes;
+    static uint16_t written_crc;  // Of all the file data, as written to the card
+  #endif
+
   static void idle() {
     // If a transfer is interrupted and a file is left open, abort it after TIMEOUT ms
     const millis_t ms = millis();
@@ -148,7 +194,13 @@ public:
       case FileTransfer::QUERY:
         SERIAL_ECHOPGM("PFT:version:", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
         #if ENABLED(BINARY_STREAM_COMPRESSION)
-          SERIAL_ECHOLNPGM(":compression:heatshrink,", HEATSHRINK_STATIC_WINDOW_BITS, ",", HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+          // An optional payload of [window, lookahead] bits requests compression settings.
+          // Without it the largest window is offered. The reply has the values to use.
+          if (length >= 2)
+            negotiate(uint8_t(buffer[0]), uint8_t(buffer[1]));
+          else
+            negotiate(HEATSHRINK_STATIC_WINDOW_BITS, HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+          SERIAL_ECHOLNPGM(":compression:heatshrink,", window_bits, ",", lookahead_bits);
         #else
           SERIAL_ECHOLNPGM(":compression:none");
         #endif
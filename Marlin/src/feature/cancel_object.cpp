@@ -31,7 +31,8 @@
 CancelObject cancelable;
 
 int8_t CancelObject::object_count, // = 0
-       CancelObject::active_object = -1;
+       CancelObject::active_object = -1,
+       CancelObject::read_object = -1;
 uint32_t CancelObject::canceled; // = 0x0000
 bool CancelObject::skipping; // = false
 
@@ -66,6 +67,26 @@ void CancelObject::uncancel_object(const int8_t obj) {
   }
 }
 
+/**
+ * Track the object being read from a file as its M486 lines are queued,
+ * so the reader can skip the rest of an object once it is canceled.
+ */
+void CancelObject::early_parse_M486(const char * const cmd) {
+  if (cmd[0] != 'M' || cmd[1] != '4' || cmd[2] != '8' || cmd[3] != '6' || NUMERIC(cmd[4])) return;
+
+  bool seen_s = false, seen_t = false;
+  int obj = -1;
+  for (const char *p = cmd + 4; *p && *p != 'A' && *p != '"'; ++p) { // Stop at an object name
+    if (*p == 'S') { seen_s = true; obj = atoi(p + 1); }
+    else if (*p == 'T') seen_t = true;
+  }
+
+  if (seen_s)
+    read_object = WITHIN(obj, 0, 31) ? obj : -1;
+  else if (seen_t)
+    read_object = -1;
+}
+
 void CancelObject::report() {
   if (active_object >= 0)
     SERIAL_ECHO_MSG("Active Object: ", active_object);
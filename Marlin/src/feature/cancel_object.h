@@ -27,6 +27,7 @@ class CancelObject {
 public:
   static bool skipping;
   static int8_t object_count, active_object;
+  static int8_t read_object;  // Object being read from the SD file, ahead of the one being printed
   static uint32_t canceled;
   static void set_active_object(const int8_t obj);
   static void cancel_object(const int8_t obj);
@@ -35,7 +36,12 @@ public:
   static bool is_canceled(const int8_t obj) { return TEST(canceled, obj); }
   static void clear_active_object() { set_active_object(-1); }
   static void cancel_active_object() { cancel_object(active_object); }
-  static void reset() { canceled = 0x0000; object_count = 0; clear_active_object(); }
+  static void reset(const bool new_job=false) {
+    canceled = 0x0000; object_count = 0; clear_active_object();
+    if (new_job) read_object = -1;
+  }
+  static bool is_read_object_canceled() { return read_object >= 0 && is_canceled(read_object); }
+  static void early_parse_M486(const char * const cmd);
 };
 
 extern CancelObject cancelable;
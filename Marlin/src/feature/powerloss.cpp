@@ -48,6 +48,21 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::dwin_flag; // = false
 #endif
 
+#ifdef POWER_LOSS_JOURNAL_SLOTS
+  #include "../libs/crc16.h"
+
+  static_assert(sizeof(plr_journal_slot_t) <= 512, "job_recovery_info_t is too large for a POWER_LOSS_JOURNAL_SLOTS sector.");
+
+  uint32_t PrintJobRecovery::journal_seq; // = 0
+  uint8_t PrintJobRecovery::journal_slot; // = 0
+
+  // Whole-sector buffer so each slot goes straight to the card, bypassing the volume cache
+  static union {
+    plr_journal_slot_t slot;
+    uint8_t sector[512];
+  } journal_buf;
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -153,6 +168,10 @@ bool PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
+  #ifdef POWER_LOSS_JOURNAL_SLOTS
+    if (file.isOpen()) close();   // The journal stays open during the print
+    journal_seq = journal_slot = 0;
+  #endif
   card.removeJobRecoveryFile();
 }
 
@@ -160,9 +179,29 @@ void PrintJobRecovery::purge() {
  * Load the recovery data, if it exists
  */
 void PrintJobRecovery::load() {
+  #ifdef POWER_LOSS_JOURNAL_SLOTS
+    if (file.isOpen()) close();
+    journal_seq = journal_slot = 0;
+  #endif
   if (exists()) {
     open(true);
-    (void)file.read(&info, sizeof(info));
+    #ifdef POWER_LOSS_JOURNAL_SLOTS
+      // Scan every slot and keep the newest one that checks out
+      plr_journal_slot_t &slot = journal_buf.slot;
+      for (uint8_t i = 0; i < POWER_LOSS_JOURNAL_SLOTS; ++i) {
+        if (!file.seekSet(uint32_t(i) * 512) || file.read(&slot, sizeof(slot)) != int16_t(sizeof(slot))) break;
+        if (slot.seq <= journal_seq || slot.size != sizeof(info)) continue;
+        uint16_t crc = 0;
+        crc16(&crc, &slot.info, sizeof(slot.info));
+        if (crc != slot.crc) continue;
+        info = slot.info;
+        journal_seq = slot.seq;
+        journal_slot = (i + 1) % (POWER_LOSS_JOURNAL_SLOTS);
+      }
+      if (!journal_seq) init();
+    #else
+      (void)file.read(&info, sizeof(info));
+    #endif
     close();
   }
   debug(F("Load"));
@@ -363,13 +402,59 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  #ifdef POWER_LOSS_JOURNAL_SLOTS
+
+    // Write the next slot in rotation as one whole sector
+    if (!journal_open()) return;
+    plr_journal_slot_t &slot = journal_buf.slot;
+    slot.seq = ++journal_seq;
+    slot.size = sizeof(info);
+    slot.info = info;
+    slot.crc = 0;
+    crc16(&slot.crc, &slot.info, sizeof(slot.info));
+    file.seekSet(uint32_t(journal_slot) * 512);
+    if (file.write(journal_buf.sector, sizeof(journal_buf.sector)) == -1) DEBUG_ECHOLNPGM("Power-loss journal write failed.");
+    if (++journal_slot >= POWER_LOSS_JOURNAL_SLOTS) journal_slot = 0;
+
+  #else
+
+    open(false);
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+
+  #endif
 }
 
+#ifdef POWER_LOSS_JOURNAL_SLOTS
+
+  /**
+   * Open the journal for the rest of the print. A fresh journal (or one left
+   * over from an earlier job) is zeroed out to full size up front, so slot
+   * writes never grow the file or touch the FAT and directory entry.
+   */
+  bool PrintJobRecovery::journal_open() {
+    if (file.isOpen()) return true;
+    open(false);
+    if (!file.isOpen()) return false;
+    constexpr uint32_t journal_size = uint32_t(POWER_LOSS_JOURNAL_SLOTS) * 512;
+    if (!journal_seq || file.fileSize() < journal_size) {
+      memset(&journal_buf, 0, sizeof(journal_buf));
+      file.seekSet(0);
+      for (uint8_t i = 0; i < POWER_LOSS_JOURNAL_SLOTS; ++i)
+        if (file.write(journal_buf.sector, sizeof(journal_buf.sector)) == -1) {
+          DEBUG_ECHOLNPGM("Power-loss journal create failed.");
+          close();
+          return false;
+        }
+      journal_seq = journal_slot = 0;
+    }
+    return true;
+  }
+
+#endif
+
 /**
  * Resume the saved print job
  */
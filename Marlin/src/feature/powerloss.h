@@ -134,6 +134,16 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#ifdef POWER_LOSS_JOURNAL_SLOTS
+  // One journal slot per SD sector. The newest slot with a good CRC is resumed.
+  typedef struct {
+    uint32_t seq;               // Save sequence number, 0 for an empty slot
+    uint16_t size;              // sizeof(job_recovery_info_t) at write time
+    uint16_t crc;               // CRC16 of info
+    job_recovery_info_t info;
+  } plr_journal_slot_t;
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -149,6 +159,11 @@ class PrintJobRecovery {
       static bool dwin_flag;
     #endif
 
+    #ifdef POWER_LOSS_JOURNAL_SLOTS
+      static uint32_t journal_seq;    //!< Sequence number of the newest slot
+      static uint8_t journal_slot;    //!< Slot to be written next
+    #endif
+
     static void init();
     static void prepare();
 
@@ -215,6 +230,10 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #ifdef POWER_LOSS_JOURNAL_SLOTS
+      static bool journal_open();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
@@ -77,7 +77,9 @@ void GcodeSuite::M420() {
         bedlevel.z_values[x][y] = 0.001 * random(-200, 200);
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
       }
-      TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+      #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+        bedlevel.refresh_bed_level();
+      #endif
       SERIAL_ECHOPGM("Simulated " STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh ");
       SERIAL_ECHOPGM(" (", x_min);
       SERIAL_CHAR(','); SERIAL_ECHO(y_min);
@@ -149,6 +151,7 @@ void GcodeSuite::M420() {
 
           set_bed_leveling_enabled(false);
           bedlevel.adjust_mesh_to_mean(true, cval);
+          bedlevel.refresh_bed_level();
 
         #else
 
@@ -181,7 +184,9 @@ void GcodeSuite::M420() {
               bedlevel.z_values[x][y] -= zmean;
               TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
             }
-            TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+            #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+              bedlevel.refresh_bed_level();
+            #endif
           }
 
         #endif
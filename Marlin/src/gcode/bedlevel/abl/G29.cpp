@@ -45,6 +45,9 @@
 #if ENABLED(BD_SENSOR_PROBE_NO_STOP)
   #include "../../../feature/bedlevel/bdl/bdl.h"
 #endif
+#if ENABLED(OPTIMIZE_PROBE_ORDER)
+  #include "../../../feature/bedlevel/probe_order.h"
+#endif
 
 #include "../../../lcd/marlinui.h"
 #if ENABLED(EXTENSIBLE_UI)
@@ -151,6 +154,11 @@ public:
   #endif
 #endif
 
+#if ALL(OPTIMIZE_PROBE_ORDER, IS_KINEMATIC)
+  // Leave points outside the round or hexagonal area out of the plan
+  static bool probe_cannot_reach(const xy_uint8_t &pos) { return !probe.can_reach(ProbeOrder::position(pos)); }
+#endif
+
 /**
  * G29: Detailed Z probe, probes the bed at 3 or more points.
  *      Will fail if the printer has not been homed with G28.
@@ -437,6 +445,7 @@ G29_TYPE GcodeSuite::G29() {
     #endif
 
     TERN_(EXTENSIBLE_UI, ExtUI::onLevelingStart());
+    TERN_(HAS_PROBE_SPREAD, reset_probe_spread());
 
     if (!faux) {
       remember_feedrate_scaling_off();
@@ -509,6 +518,21 @@ G29_TYPE GcodeSuite::G29() {
       TERN_(IS_KINEMATIC, COPY(abl.z_values, bedlevel.z_values));
     #endif // AUTO_BED_LEVELING_BILINEAR
 
+    #if ENABLED(OPTIMIZE_PROBE_ORDER)
+    {
+      // Probe in the order with the least travel from here
+      ProbeOrder::set_grid(abl.grid_points, abl.probe_position_lf, abl.gridSpacing, TERN(IS_KINEMATIC, probe_cannot_reach, nullptr));
+      const xy_pos_t probe_xy = current_position + probe.offset_xy;
+      uint8_t sweep = TERN0(PROBE_Y_FIRST, ProbeOrder::SWEEP_Y_FIRST);
+      #if DISABLED(PROBE_MANUALLY)
+        // The default order always ends at the right and back
+        if (!(PR_OUTER_SIZE & 1)) sweep |= TERN(PROBE_Y_FIRST, ProbeOrder::SWEEP_FLIP_Y, ProbeOrder::SWEEP_FLIP_X);
+      #endif
+      const probe_travel_t before = ProbeOrder::travel(sweep, probe_xy);
+      ProbeOrder::report(before, ProbeOrder::plan(probe_xy));
+    }
+    #endif
+
   } // !g29_in_progress
 
   #if ENABLED(PROBE_MANUALLY)
@@ -591,13 +615,22 @@ G29_TYPE GcodeSuite::G29() {
       // Skip any unreachable points
       while (abl.abl_probe_index < abl.abl_points) {
 
-        // Set abl.meshCount.x, abl.meshCount.y based on abl.abl_probe_index, with zig-zag
-        PR_OUTER_VAR = abl.abl_probe_index / PR_INNER_SIZE;
-        PR_INNER_VAR = abl.abl_probe_index - (PR_OUTER_VAR * PR_INNER_SIZE);
+        #if ENABLED(OPTIMIZE_PROBE_ORDER)
+
+          // Set abl.meshCount.x, abl.meshCount.y based on abl.abl_probe_index, in the planned order
+          abl.meshCount = ProbeOrder::point(abl.abl_probe_index);
+
+        #else
 
-        // Probe in reverse order for every other row/column
-        const bool zig = (PR_OUTER_VAR & 1); // != ((PR_OUTER_SIZE) & 1);
-        if (zig) PR_INNER_VAR = (PR_INNER_SIZE - 1) - PR_INNER_VAR;
+          // Set abl.meshCount.x, abl.meshCount.y based on abl.abl_probe_index, with zig-zag
+          PR_OUTER_VAR = abl.abl_probe_index / PR_INNER_SIZE;
+          PR_INNER_VAR = abl.abl_probe_index - (PR_OUTER_VAR * PR_INNER_SIZE);
+
+          // Probe in reverse order for every other row/column
+          const bool zig = (PR_OUTER_VAR & 1); // != ((PR_OUTER_SIZE) & 1);
+          if (zig) PR_INNER_VAR = (PR_INNER_SIZE - 1) - PR_INNER_VAR;
+
+        #endif
 
         abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
 
@@ -660,7 +693,18 @@ G29_TYPE GcodeSuite::G29() {
 
     abl.measured_z = 0;
 
-    #if ABL_USES_GRID
+    #if ABL_USES_GRID && ENABLED(OPTIMIZE_PROBE_ORDER)
+
+      // Visit the points in the planned order
+      for (grid_count_t pt_index = 1; pt_index <= abl.abl_points && !isnan(abl.measured_z); pt_index++) {
+
+        TERN_(PROUI_EX, if (ProEx.QuitLeveling()) break; )
+
+        abl.meshCount = ProbeOrder::point(pt_index - 1);
+
+        { // Nested like the zig-zag loops
+
+    #elif ABL_USES_GRID
 
       bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
@@ -692,6 +736,10 @@ G29_TYPE GcodeSuite::G29() {
         // Inner loop is X with PROBE_Y_FIRST disabled
         for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
 
+    #endif
+
+    #if ABL_USES_GRID
+
           abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
 
           TERN_(AUTO_BED_LEVELING_LINEAR, abl.indexIntoAB[abl.meshCount.x][abl.meshCount.y] = ++abl.abl_probe_index); // 0...
@@ -782,6 +830,7 @@ G29_TYPE GcodeSuite::G29() {
 
             const float z = abl.measured_z + abl.Z_offset;
             abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
+            TERN_(HAS_PROBE_SPREAD, if (!faux) probe_spread[abl.meshCount.x][abl.meshCount.y] = probe.sample_stats.stddev);
             TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
             TERN_(PROUI_EX, ProEx.MeshUpdate(abl.meshCount.x, abl.meshCount.y, z));
 
@@ -865,6 +914,8 @@ G29_TYPE GcodeSuite::G29() {
         bedlevel.print_leveling_grid();
       }
 
+      TERN_(HAS_PROBE_SPREAD, if (abl.verbose_level > 2) print_probe_spread());
+
     #elif ENABLED(AUTO_BED_LEVELING_LINEAR)
 
       // For LINEAR leveling calculate matrix, print reports, correct the position
@@ -38,6 +38,10 @@
 #include "../../../module/motion.h"
 #include "../../../module/planner.h"
 
+#if ENABLED(OPTIMIZE_PROBE_ORDER)
+  #include "../../../feature/bedlevel/probe_order.h"
+#endif
+
 #if ENABLED(EXTENSIBLE_UI)
   #include "../../../lcd/extui/ui_api.h"
 #elif ENABLED(DWIN_LCD_PROUI)
@@ -164,10 +168,25 @@ void GcodeSuite::G29() {
             0.4f
           #endif
         );
+        #if ENABLED(OPTIMIZE_PROBE_ORDER)
+          // Probe in the order with the least travel from here
+          const xy_uint8_t size = { GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y };
+          const xy_pos_t origin = { bedlevel.get_mesh_x(0), bedlevel.get_mesh_y(0) };
+          const xy_float_t spacing = { MESH_X_DIST, MESH_Y_DIST };
+          ProbeOrder::set_grid(size, origin, spacing);
+          const probe_travel_t before = ProbeOrder::travel(0, current_position);
+          ProbeOrder::report(before, ProbeOrder::plan(current_position));
+        #endif
       }
       else {
         // Save Z for the previous mesh position
-        bedlevel.set_zigzag_z(mbl_probe_index - 1, current_position.z);
+        #if ENABLED(OPTIMIZE_PROBE_ORDER)
+          const xy_uint8_t prev = ProbeOrder::point(mbl_probe_index - 1);
+          ix = prev.x; iy = prev.y;
+          bedlevel.set_z(ix, iy, current_position.z);
+        #else
+          bedlevel.set_zigzag_z(mbl_probe_index - 1, current_position.z);
+        #endif
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, current_position.z));
         TERN_(DWIN_LCD_PROUI, DWIN_MeshUpdate(_MIN(mbl_probe_index, GRID_MAX_POINTS), int(GRID_MAX_POINTS), current_position.z));
         SET_SOFT_ENDSTOP_LOOSE(false);
@@ -177,7 +196,12 @@ void GcodeSuite::G29() {
         // Disable software endstops to allow manual adjustment
         // If G29 is left hanging without completion they won't be re-enabled!
         SET_SOFT_ENDSTOP_LOOSE(true);
-        bedlevel.zigzag(mbl_probe_index++, ix, iy);
+        #if ENABLED(OPTIMIZE_PROBE_ORDER)
+          const xy_uint8_t pos = ProbeOrder::point(mbl_probe_index++);
+          ix = pos.x; iy = pos.y;
+        #else
+          bedlevel.zigzag(mbl_probe_index++, ix, iy);
+        #endif
         _manual_goto_xy({ bedlevel.index_to_xpos[ix], bedlevel.index_to_ypos[iy] });
       }
       else {
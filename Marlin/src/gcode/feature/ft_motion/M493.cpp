@@ -95,6 +95,10 @@ void say_shaping() {
     SERIAL_ECHO_TERNARY(fxdTiCtrl.cfg.linearAdvEna, "Linear Advance ", "en", "dis", "abled");
     SERIAL_ECHOLN(F(". Gain: "), p_float_t(fxdTiCtrl.cfg.linearAdvK, 5));
   #endif
+
+  #if ENABLED(FTM_COMPACT_BUFFERS)
+    SERIAL_ECHOLNPGM("Compact buffers: ", fxdTiCtrl.buffer_bytes, " bytes (", fxdTiCtrl.loose_buffer_bytes - fxdTiCtrl.buffer_bytes, " saved).");
+  #endif
 }
 
 void GcodeSuite::M493_report(const bool forReplay/*=true*/) {
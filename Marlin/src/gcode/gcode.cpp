@@ -99,6 +99,10 @@ relative_t GcodeSuite::axis_relative; // Init in constructor
   GcodeSuite::WorkspacePlane GcodeSuite::workspace_plane = PLANE_XY;
 #endif
 
+#if HAS_ARC_CHORD_TOLERANCE
+  float GcodeSuite::arc_tolerance_mm = (ARC_CHORD_TOLERANCE) * 0.001f;
+#endif
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
   int8_t GcodeSuite::active_coordinate_system = -1; // machine space
   xyz_pos_t GcodeSuite::coordinate_system[MAX_COORDINATE_SYSTEMS];
@@ -752,6 +756,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 211: M211(); break;                                  // M211: Enable, Disable, and/or Report software endstops
       #endif
 
+      #if HAS_ARC_CHORD_TOLERANCE
+        case 214: M214(); break;                                  // M214: Set the arc chord tolerance
+      #endif
+
       #if HAS_MULTI_EXTRUDER
         case 217: M217(); break;                                  // M217: Set filament swap parameters
       #endif
@@ -196,6 +196,7 @@
  * M209 - Turn Automatic Retract Detection on/off: S<0|1> (For slicers that don't support G10/11). (Requires FWRETRACT_AUTORETRACT)
           Every normal extrude-only move will be classified as retract depending on the direction.
  * M211 - Enable, Disable, and/or Report software endstops: S<0|1> (Requires MIN_SOFTWARE_ENDSTOPS or MAX_SOFTWARE_ENDSTOPS)
+ * M214 - Set the arc chord tolerance: T<microns> (Requires ARC_CHORD_TOLERANCE)
  * M217 - Set filament swap parameters: "M217 S<length> P<feedrate> R<feedrate>". (Requires SINGLENOZZLE)
  * M218 - Set/get a tool offset: "M218 T<index> X<offset> Y<offset>". (Requires 2 or more extruders)
  * M220 - Set Feedrate Percentage: "M220 S<percent>" (i.e., "FR" on the LCD)
@@ -397,6 +398,10 @@ public:
     static WorkspacePlane workspace_plane;
   #endif
 
+  #if HAS_ARC_CHORD_TOLERANCE
+    static float arc_tolerance_mm;      // Largest distance from a G2/G3 arc to its segments. 0 for fixed lengths.
+  #endif
+
   #define MAX_COORDINATE_SYSTEMS 9
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     static int8_t active_coordinate_system;
@@ -883,6 +888,11 @@ private:
   static void M211();
   static void M211_report(const bool forReplay=true);
 
+  #if HAS_ARC_CHORD_TOLERANCE
+    static void M214();
+    static void M214_report(const bool forReplay=true);
+  #endif
+
   #if HAS_MULTI_EXTRUDER
     static void M217();
     static void M217_report(const bool forReplay=true);
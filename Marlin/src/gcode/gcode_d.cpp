@@ -30,6 +30,10 @@
   #include "queue.h"
 #endif
 
+#if ENABLED(PLANNER_STATISTICS)
+  #include "../module/planner.h"
+#endif
+
 #include "../module/settings.h"
 #include "../module/temperature.h"
 #include "../libs/hex_print.h"
@@ -297,6 +301,16 @@ void GcodeSuite::D(const int16_t dcode) {
       }
 
     #endif // BUFFER_MONITORING
+
+    #if ENABLED(PLANNER_STATISTICS)
+      /**
+       * D577 - Report planner kernel runs per queued block
+       *   R<bool> : Reset the counters after the report (Default true)
+       */
+      case 577:
+        planner.report_kernel_stats(parser.boolval('R', true));
+        break;
+    #endif
   }
 }
 
@@ -29,6 +29,10 @@
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(FT_MOTION)
+  #include "../../module/ft_motion.h"
+#endif
+
 #if ENABLED(DELTA)
   #include "../../module/delta.h"
 #elif ENABLED(SCARA)
@@ -202,23 +206,44 @@ void plan_arc(
   // Feedrate for the move, scaled by the feedrate multiplier
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
-  // Get the ideal segment length for the move based on settings
-  const float ideal_segment_mm = (
-    #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
-      constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
-    #else
-      MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
-    #endif
-  );
+  uint16_t segments;
+
+  #if HAS_ARC_CHORD_TOLERANCE
+    if (gcode.arc_tolerance_mm) {
+      // The longest chord whose midpoint is within the tolerance of the arc
+      const float tol = gcode.arc_tolerance_mm;
+      float chord_mm = tol < radius ? 2 * SQRT(tol * (2 * radius - tol)) : 2 * radius;
+
+      // Don't go below the minimum length, or below the length needed to limit the segment rate
+      #if ARC_SEGMENTS_PER_SEC
+        NOLESS(chord_mm, scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC));
+      #endif
+      NOLESS(chord_mm, MIN_ARC_SEGMENT_MM);
 
-  // Number of whole segments based on the ideal segment length
-  const float nominal_segments = _MAX(FLOOR(flat_mm / ideal_segment_mm), min_segments),
-              nominal_segment_mm = flat_mm / nominal_segments;
+      segments = _MAX(CEIL(flat_mm / chord_mm), min_segments);
+    }
+    else
+  #endif
+  {
+    // Get the ideal segment length for the move based on settings
+    const float ideal_segment_mm = (
+      #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
+        constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
+      #else
+        MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
+      #endif
+    );
+
+    // Number of whole segments based on the ideal segment length
+    const float nominal_segments = _MAX(FLOOR(flat_mm / ideal_segment_mm), min_segments),
+                nominal_segment_mm = flat_mm / nominal_segments;
+
+    // The number of whole segments in the arc, with best attempt to honor MIN_ARC_SEGMENT_MM and MAX_ARC_SEGMENT_MM
+    segments = nominal_segment_mm > (MAX_ARC_SEGMENT_MM) ? CEIL(flat_mm / (MAX_ARC_SEGMENT_MM)) :
+               nominal_segment_mm < (MIN_ARC_SEGMENT_MM) ? _MAX(1, FLOOR(flat_mm / (MIN_ARC_SEGMENT_MM))) :
+               nominal_segments;
+  }
 
-  // The number of whole segments in the arc, with best attempt to honor MIN_ARC_SEGMENT_MM and MAX_ARC_SEGMENT_MM
-  const uint16_t segments = nominal_segment_mm > (MAX_ARC_SEGMENT_MM) ? CEIL(flat_mm / (MAX_ARC_SEGMENT_MM)) :
-                            nominal_segment_mm < (MIN_ARC_SEGMENT_MM) ? _MAX(1, FLOOR(flat_mm / (MIN_ARC_SEGMENT_MM))) :
-                            nominal_segments;
   const float segment_mm = flat_mm / segments;
 
   // Add hints to help optimize the move
@@ -227,6 +252,100 @@ void plan_arc(
     hints.inv_duration = (scaled_fr_mm_s / flat_mm) * segments;
   #endif
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+
+    /**
+     * Queue the arc as arc blocks, with the segments becoming chords traced by the stepper.
+     * With bed leveling active, split the arc into pieces of ARC_NATIVE_LEVELED_MM or less
+     * so the leveled Z can follow the mesh. Use linear segments instead when Fixed-Time Motion
+     * is active, when leveling an arc outside the XY plane, or when the whole circle doesn't
+     * fit inside the software endstops, since only the ends of a block are clamped.
+     */
+    const bool arc_in_bounds = !soft_endstop.enabled() || TERN1(HAS_SOFTWARE_ENDSTOPS, (
+         center_P - radius >= soft_endstop.min[axis_p] && center_P + radius <= soft_endstop.max[axis_p]
+      && center_Q - radius >= soft_endstop.min[axis_q] && center_Q + radius <= soft_endstop.max[axis_q]
+    ));
+
+    if (segments > 1 && arc_in_bounds
+      && !TERN0(FT_MOTION, fxdTiCtrl.cfg.mode)
+      && !(planner.leveling_active && axis_p != X_AXIS)
+    ) {
+      uint16_t pieces = 1;
+      #if HAS_LEVELING
+        if (planner.leveling_active) pieces = _MAX(1, CEIL(flat_mm / float(ARC_NATIVE_LEVELED_MM)));
+      #endif
+      const uint16_t chords = (segments + pieces - 1) / pieces;
+
+      const float theta_per_piece = angular_travel / pieces,
+                  theta_per_chord = theta_per_piece / chords,
+                  piece_mm = SQRT(sq(flat_mm)
+                    GANG_N(SUB2(NUM_AXES),
+                      + sq(travel_L), + sq(travel_I), + sq(travel_J), + sq(travel_K),
+                      + sq(travel_U), + sq(travel_V), + sq(travel_W)
+                    )
+                  ) / pieces;
+
+      // See the segmented arc below for the safe exit speed
+      const float limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[axis_p], planner.settings.max_acceleration_mm_per_s2[axis_q]),
+                  limiting_speed = _MIN(planner.settings.max_feedrate_mm_s[axis_p], planner.settings.max_feedrate_mm_s[axis_q]),
+                  limiting_speed_sqr = _MIN(sq(limiting_speed), limiting_accel * radius, sq(scaled_fr_mm_s));
+
+      hints.millimeters = piece_mm;
+      TERN_(FEEDRATE_SCALING, hints.inv_duration = scaled_fr_mm_s / piece_mm);
+      hints.arc.cos_T = cos(theta_per_chord);
+      hints.arc.sin_T = sin(theta_per_chord);
+      hints.arc.chords = chords;
+      hints.arc.axis_p = axis_p;
+      hints.arc.axis_q = axis_q;
+
+      xyze_pos_t raw = current_position;
+      for (uint16_t i = 1; i <= pieces; ++i) {
+        thermalManager.task();
+        if (i > 1) idle();
+
+        // The arc block starts from the end of the previous piece
+        hints.arc.rvec.set(rvec.a, rvec.b);
+
+        if (i < pieces) {
+          const float Ti = i * theta_per_piece, cos_Ti = cos(Ti), sin_Ti = sin(Ti), frac = float(i) / pieces;
+          rvec.a = -offset[0] * cos_Ti + offset[1] * sin_Ti;
+          rvec.b = -offset[0] * sin_Ti - offset[1] * cos_Ti;
+          raw[axis_p] = center_P + rvec.a;
+          raw[axis_q] = center_Q + rvec.b;
+          ARC_LIJKUVWE_CODE(
+            raw[axis_l] = current_position[axis_l] + travel_L * frac,
+            raw.i       = current_position.i       + travel_I * frac,
+            raw.j       = current_position.j       + travel_J * frac,
+            raw.k       = current_position.k       + travel_K * frac,
+            raw.u       = current_position.u       + travel_U * frac,
+            raw.v       = current_position.v       + travel_V * frac,
+            raw.w       = current_position.w       + travel_W * frac,
+            raw.e       = current_position.e       + travel_E * frac
+          );
+        }
+        else
+          raw = cart;
+
+        apply_motion_limits(raw);
+
+        #if HAS_LEVELING && !PLANNER_LEVELING
+          planner.apply_leveling(raw);
+        #endif
+
+        hints.safe_exit_speed_sqr = _MIN(limiting_speed_sqr, 2 * limiting_accel * (pieces - i) * (flat_mm / pieces));
+
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
+          break;
+
+        hints.curve_radius = radius;
+      }
+
+      current_position = raw;
+      return;
+    }
+
+  #endif // ARC_NATIVE_BLOCKS
+
   /**
    * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
    * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
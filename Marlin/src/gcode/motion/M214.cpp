@@ -0,0 +1,53 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if HAS_ARC_CHORD_TOLERANCE
+
+#include "../gcode.h"
+
+/**
+ * M214: Set the arc chord tolerance
+ *
+ *  T<microns>  Largest distance between a G2/G3 arc and its segments.
+ *              Segments get longer with the radius of the arc.
+ *              T0 uses MIN_ARC_SEGMENT_MM / MAX_ARC_SEGMENT_MM instead.
+ */
+void GcodeSuite::M214() {
+  if (!parser.seen_any()) return M214_report();
+
+  if (parser.seenval('T')) {
+    const float tol = parser.value_float();
+    if (WITHIN(tol, 0, 1000))
+      arc_tolerance_mm = tol * 0.001f;
+    else
+      SERIAL_ERROR_MSG("?T out of range (0 to 1000)");
+  }
+}
+
+void GcodeSuite::M214_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F(STR_ARC_TOLERANCE));
+  SERIAL_ECHOLNPGM("  M214 T", arc_tolerance_mm * 1000.0f);
+}
+
+#endif // HAS_ARC_CHORD_TOLERANCE
@@ -57,6 +57,10 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS)
+  #include "../feature/cancel_object.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -564,6 +568,89 @@ void GCodeQueue::get_serial_commands() {
 
 #if HAS_MEDIA
 
+  #if ENABLED(CANCEL_OBJECTS)
+
+    #define SKIP_LINES_PER_CALL 100
+
+    static bool sd_skip_held; // = false. Skipping ended on a line that must be queued.
+    static char e_word[16], f_word[16];   // Last E and F words skipped, e.g. "E12.345"
+
+    void GCodeQueue::reset_canceled_skip() {
+      sd_skip_held = false;
+      e_word[0] = f_word[0] = '\0';
+    }
+
+    /**
+     * Read past the lines of a canceled object without parsing or queueing them.
+     * Moves don't change XYZ while an object is skipped, so only the last E and F
+     * words matter. These are queued as a single move when the skip ends.
+     * The move runs while the object is still canceled, so it only sets the E position.
+     * With absolute E that is where the skipped moves would have left it. With relative
+     * E it shifts the position by the last E value, not by the sum of the skipped ones.
+     * Any line other than G0-G3 or a comment ends the skip and is read normally.
+     * This includes the next M486. Return false if there are more lines to skip,
+     * otherwise return true with a move or an empty string in the buffer.
+     */
+    static bool skip_canceled_lines(char (&buff)[MAX_CMD_SIZE]) {
+      auto upper = [](const char c) -> char { return TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')) ? c - 'a' + 'A' : c; };
+
+      for (uint8_t lines = 0; !card.eof(); ++lines) {
+        if (lines >= SKIP_LINES_PER_CALL) return false;       // Give the main loop a turn
+
+        // Read the raw line, keeping its start to rewind to
+        const uint32_t line_start = card.getIndex();
+        uint8_t len = 0;
+        bool ok = true;
+        while (!card.eof()) {
+          const int16_t n = card.get();
+          if (n < 0) { ok = false; break; }
+          if (ISEOL(char(n))) break;
+          if (len < MAX_CMD_SIZE - 1) buff[len++] = char(n); else ok = false;
+        }
+        buff[len] = '\0';
+
+        const char *p = buff;
+        while (*p == ' ') ++p;
+        if (ok && (*p == '\0' || *p == ';')) continue;  // Blank line or comment
+
+        // Find the E and F words of a plain move
+        const char *e = nullptr, *f = nullptr;
+        uint8_t e_len = 0, f_len = 0;
+        if (ok) ok = upper(p[0]) == 'G' && WITHIN(p[1], '0', '3') && !NUMERIC(p[2]) && p[2] != '.';
+        if (ok) for (p += 2; *p && *p != ';'; ++p) {
+          if (*p == '(' || *p == '"' || *p == '\\') { ok = false; break; }
+          const char c = upper(*p);
+          if (c != 'E' && c != 'F') continue;
+          uint8_t l = 1;
+          while (NUMERIC_SIGNED(p[l]) || p[l] == '.') ++l;
+          if (l >= sizeof(e_word)) { ok = false; break; }
+          if (l == 1) continue;                                 // No value
+          if (c == 'E') { e = p; e_len = l; } else { f = p; f_len = l; }
+          p += l - 1;
+        }
+
+        if (!ok) {
+          // Rewind so this line is read and queued as usual
+          card.setIndex(line_start);
+          sd_skip_held = true;
+          break;
+        }
+
+        if (e) { strncpy(e_word, e, e_len); e_word[e_len] = '\0'; e_word[0] = 'E'; }
+        if (f) { strncpy(f_word, f, f_len); f_word[f_len] = '\0'; f_word[0] = 'F'; }
+      }
+
+      // Queue the last E and F words to keep absolute E in step
+      if (e_word[0] || f_word[0])
+        sprintf_P(buff, PSTR("G1 %s %s"), e_word, f_word);
+      else
+        buff[0] = '\0';
+      e_word[0] = f_word[0] = '\0';
+      return true;
+    }
+
+  #endif // CANCEL_OBJECTS
+
   /**
    * Get lines from the SD Card until the command buffer is full
    * or until the end of the file is reached. Because this method
@@ -578,15 +665,31 @@ void GCodeQueue::get_serial_commands() {
 
     int sd_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
+      CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+
+      #if ENABLED(CANCEL_OBJECTS)
+        // Fast-forward through a canceled object, starting at a new line
+        if (!sd_skip_held && sd_count == 0 && sd_input_state == PS_NORMAL && cancelable.is_read_object_canceled()) {
+          if (!skip_canceled_lines(command.buffer)) return;   // Continue skipping on the next call
+          if (command.buffer[0]) {
+            ring_buffer.commit_command(true);
+            TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+          }
+          if (card.eof()) card.fileHasFinished();
+          continue;
+        }
+      #endif
+
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
-      CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
       if (is_eol || card_eof) {
 
+        TERN_(CANCEL_OBJECTS, sd_skip_held = false);
+
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
         if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
@@ -594,6 +697,9 @@ void GCodeQueue::get_serial_commands() {
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
           TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
 
+          // M486 S sets the object being read, so its lines can be skipped once canceled
+          TERN_(CANCEL_OBJECTS, cancelable.early_parse_M486(command.buffer));
+
           #if DISABLED(PARK_HEAD_ON_PAUSE)
             // When M25 is non-blocking it can still suspend SD commands
             // Otherwise the M125 handler needs to know SD printing is active
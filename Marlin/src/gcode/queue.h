@@ -252,6 +252,11 @@ public:
 
   #endif // BUFFER_MONITORING
 
+  #if ALL(HAS_MEDIA, CANCEL_OBJECTS)
+    // Forget a canceled-object skip left over from an aborted print
+    static void reset_canceled_skip();
+  #endif
+
 private:
 
   static void get_serial_commands();
@@ -510,6 +510,9 @@
 #if ENABLED(DWIN_LCD_PROUI)
   #define DO_LIST_BIN_FILES 1
   #define LCD_BRIGHTNESS_DEFAULT 100
+  #if DWIN_TX_QUEUE_SIZE
+    #define HAS_DWIN_TX_QUEUE 1
+  #endif
 #endif
 
 // Serial Controllers require LCD_SERIAL_PORT
@@ -1481,6 +1484,9 @@
 #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL, MESH_BED_LEVELING)
   #define HAS_MESH 1
 #endif
+#if ALL(HAS_MESH, PROBE_BUMP_SAMPLING)
+  #define HAS_PROBE_SPREAD 1
+#endif
 #if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_3POINT)
   #define NEEDS_THREE_PROBE_POINTS 1
 #endif
@@ -1220,6 +1220,11 @@
   #define CASELIGHT_USES_BRIGHTNESS 1
 #endif
 
+// Flag for the valued ARC_CHORD_TOLERANCE, which may be set to 0 and enabled with M214
+#if ENABLED(ARC_SUPPORT) && defined(ARC_CHORD_TOLERANCE)
+  #define HAS_ARC_CHORD_TOLERANCE 1
+#endif
+
 // Flag whether least_squares_fit.cpp is used
 #if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, HAS_Z_STEPPER_ALIGN_STEPPER_XY)
   #define NEED_LSF 1
@@ -1274,6 +1279,11 @@
   #undef TC_GCODE_USE_GLOBAL_Z
 #endif
 
+// Planner kernel counters
+#if ANY(PLANNER_STATISTICS, MARLIN_TEST_BUILD)
+  #define HAS_PLANNER_STATS 1
+#endif
+
 // Multi-Stepping Limit
 #ifndef MULTISTEPPING_LIMIT
   #define MULTISTEPPING_LIMIT 128
@@ -3001,6 +3001,9 @@
 #if ENABLED(SEGMENT_LEVELED_MOVES) && !defined(LEVELED_SEGMENT_LENGTH)
   #define LEVELED_SEGMENT_LENGTH 5
 #endif
+#if ALL(SEGMENT_LEVELED_MOVES, LEVELED_SEGMENT_CELLS) && ANY(MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR) && IS_CARTESIAN
+  #define HAS_LEVELED_CELL_SEGMENTS 1
+#endif
 
 /**
  * Default mesh area is an area with an inset margin on the print area.
@@ -421,6 +421,24 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
 #endif
 #undef SD_CONNECTION_TYPICAL
 
+/**
+ * Custom thermistor lookup table
+ */
+#if HAS_USER_THERMISTORS && defined(USER_THERMISTOR_LUT_STEP) && (USER_THERMISTOR_LUT_STEP < 1 || (USER_THERMISTOR_LUT_STEP & (USER_THERMISTOR_LUT_STEP - 1)))
+  #error "USER_THERMISTOR_LUT_STEP must be a power of 2."
+#endif
+
+#if defined(THERMISTOR_LUT_STEP) && (THERMISTOR_LUT_STEP < 1 || (THERMISTOR_LUT_STEP & (THERMISTOR_LUT_STEP - 1)))
+  #error "THERMISTOR_LUT_STEP must be a power of 2."
+#endif
+
+/**
+ * SD Read-ahead buffer
+ */
+#if SD_READAHEAD_SIZE && (SD_READAHEAD_SIZE % 512 || SD_READAHEAD_SIZE > 4096)
+  #error "SD_READAHEAD_SIZE must be a multiple of 512, up to 4096."
+#endif
+
 /**
  * SD File Sorting
  */
@@ -1467,6 +1485,18 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #endif
   #endif
 
+  #if ENABLED(PROBE_BUMP_SAMPLING)
+    #if PROUI_EX
+      #error "PROBE_BUMP_SAMPLING is not compatible with PROUI_EX."
+    #elif ENABLED(BD_SENSOR)
+      #error "PROBE_BUMP_SAMPLING is not compatible with BD_SENSOR."
+    #elif !(MULTIPLE_PROBING > 1)
+      #error "PROBE_BUMP_SAMPLING requires MULTIPLE_PROBING of 2 or more."
+    #endif
+    static_assert(PROBE_BUMP_MM > 0 && PROBE_BUMP_MM < Z_CLEARANCE_MULTI_PROBE, "PROBE_BUMP_MM must be greater than 0 and less than Z_CLEARANCE_MULTI_PROBE.");
+    static_assert(PROBE_BUMP_MAX_STDDEV > 0, "PROBE_BUMP_MAX_STDDEV must be greater than 0.");
+  #endif
+
   #if Z_PROBE_LOW_POINT > 0
     #error "Z_PROBE_LOW_POINT must be less than or equal to 0."
   #endif
@@ -1488,6 +1518,10 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "Auto Bed Leveling requires either PROBE_MANUALLY, SENSORLESS_PROBING, or a real probe."
   #endif
 
+  #if ENABLED(PROBE_BUMP_SAMPLING)
+    #error "PROBE_BUMP_SAMPLING requires a real probe."
+  #endif
+
   #if ENABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
     #error "Z_MIN_PROBE_REPEATABILITY_TEST requires a real probe."
   #endif
@@ -1571,6 +1605,14 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
 #endif
 #undef _POINT_COUNT
 
+#if ENABLED(OPTIMIZE_PROBE_ORDER)
+  #if !(ABL_USES_GRID || ANY(MESH_BED_LEVELING, AUTO_BED_LEVELING_UBL))
+    #error "OPTIMIZE_PROBE_ORDER requires grid-based bed leveling."
+  #elif ENABLED(BD_SENSOR_PROBE_NO_STOP)
+    #error "OPTIMIZE_PROBE_ORDER is not compatible with BD_SENSOR_PROBE_NO_STOP."
+  #endif
+#endif
+
 #if ALL(HAS_LEVELING, RESTORE_LEVELING_AFTER_G28, ENABLE_LEVELING_AFTER_G28)
   #error "Only enable RESTORE_LEVELING_AFTER_G28 or ENABLE_LEVELING_AFTER_G28, but not both."
 #endif
@@ -3501,6 +3543,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 #if ENABLED(POWER_LOSS_RECOVERY)
   #if ENABLED(BACKUP_POWER_SUPPLY) && !PIN_EXISTS(POWER_LOSS)
     #error "BACKUP_POWER_SUPPLY requires a POWER_LOSS_PIN."
+  #elif defined(POWER_LOSS_JOURNAL_SLOTS) && !WITHIN(POWER_LOSS_JOURNAL_SLOTS, 2, 255)
+    #error "POWER_LOSS_JOURNAL_SLOTS must be from 2 to 255."
   #elif ALL(POWER_LOSS_PULLUP, POWER_LOSS_PULLDOWN)
     #error "You can't enable POWER_LOSS_PULLUP and POWER_LOSS_PULLDOWN at the same time."
   #elif ENABLED(POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MAX
@@ -3848,6 +3892,9 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 #if ALL(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#if defined(BINARY_STREAM_MAX_WINDOW_BITS) && !WITHIN(BINARY_STREAM_MAX_WINDOW_BITS, 4, 15)
+  #error "BINARY_STREAM_MAX_WINDOW_BITS must be from 4 to 15."
+#endif
 
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
@@ -4115,11 +4162,32 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #endif
 #endif
 
+/**
+ * Native arc blocks
+ */
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  #if IS_KINEMATIC || IS_CORE || ANY(MARKFORGED_XY, MARKFORGED_YX)
+    #error "ARC_NATIVE_BLOCKS requires Cartesian kinematics."
+  #elif ENABLED(BACKLASH_COMPENSATION)
+    #error "ARC_NATIVE_BLOCKS is not compatible with BACKLASH_COMPENSATION."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "ARC_NATIVE_BLOCKS is not compatible with SKEW_CORRECTION."
+  #elif HAS_ZV_SHAPING
+    #error "ARC_NATIVE_BLOCKS is not compatible with INPUT_SHAPING_X or INPUT_SHAPING_Y."
+  #elif defined(__AVR__)
+    #error "ARC_NATIVE_BLOCKS requires a 32-bit MCU."
+  #elif HAS_LEVELING && !defined(ARC_NATIVE_LEVELED_MM)
+    #error "ARC_NATIVE_BLOCKS requires ARC_NATIVE_LEVELED_MM with bed leveling."
+  #endif
+#endif
+
 /**
  * Fixed-Time Motion limitations
  */
 #if ALL(FT_MOTION, MIXING_EXTRUDER)
   #error "FT_MOTION does not currently support MIXING_EXTRUDER."
+#elif ALL(FT_MOTION, FTM_COMPACT_BUFFERS) && LOGICAL_AXES > 7
+  #error "FTM_COMPACT_BUFFERS supports up to 7 logical axes."
 #endif
 
 // Multi-Stepping Limit
@@ -35,12 +35,84 @@
 uint8_t DWIN_SendBuf[11 + DWIN_WIDTH / 6 * 2] = { 0xAA };
 uint8_t DWIN_BufTail[4] = { 0xCC, 0x33, 0xC3, 0x3C };
 uint8_t databuf[26] = { 0 };
+bool DWIN_FrameDirty = false;
+
+#if HAS_DWIN_TX_QUEUE
+
+  static_assert(DWIN_TX_QUEUE_SIZE >= sizeof(DWIN_SendBuf) + sizeof(DWIN_BufTail), "DWIN_TX_QUEUE_SIZE must hold at least one full packet.");
+
+  // Packets are coalesced in a ring buffer and handed to the serial port in bulk
+  static uint8_t dwin_txq[DWIN_TX_QUEUE_SIZE];
+  static uint16_t txq_head = 0, txq_count = 0;
+
+  dwin_tx_stats_t DWIN_TxStats = { 0 };
+
+  void DWIN_TxDrain(const bool all/*=false*/) {
+    while (txq_count) {
+      size_t n = _MIN(txq_count, uint16_t(DWIN_TX_QUEUE_SIZE - txq_head));
+      #ifdef LCD_SERIAL_TX_BUFFER_FREE
+        if (!all) {
+          const int room = LCD_SERIAL_TX_BUFFER_FREE();
+          if (room <= 0) break;
+          NOMORE(n, size_t(room));
+        }
+      #endif
+      LCD_SERIAL.write(&dwin_txq[txq_head], n);
+      txq_head = (txq_head + n) % (DWIN_TX_QUEUE_SIZE);
+      txq_count -= n;
+    }
+  }
+
+  void DWIN_Write(const uint8_t *data, const size_t len) {
+    if (txq_count + len > DWIN_TX_QUEUE_SIZE) {
+      DWIN_TxStats.stalls++;
+      DWIN_TxFlush();
+      // Data blocks (e.g., DWIN_WriteToMem) may be larger than the queue. Send them straight out.
+      if (len > DWIN_TX_QUEUE_SIZE) {
+        LCD_SERIAL.write(data, len);
+        DWIN_TxStats.bytes += len;
+        return;
+      }
+    }
+    uint16_t t = (txq_head + txq_count) % (DWIN_TX_QUEUE_SIZE);
+    for (size_t n = 0; n < len; ++n) {
+      dwin_txq[t] = data[n];
+      if (++t == DWIN_TX_QUEUE_SIZE) t = 0;
+    }
+    txq_count += len;
+    NOLESS(DWIN_TxStats.peak, txq_count);
+    DWIN_TxStats.bytes += len;
+  }
+
+  // Report the transport throughput since the last reset
+  void DWIN_TxReport(const bool reset/*=true*/) {
+    const millis_t ms = millis(), elapsed = _MAX(ms - DWIN_TxStats.since_ms, 1UL);
+    SERIAL_ECHOLNPGM("DWIN TX"
+      " bytes/s:", (DWIN_TxStats.bytes * 1000UL) / elapsed,
+      " frames/s:", (DWIN_TxStats.frames * 1000UL) / elapsed,
+      " peak:", DWIN_TxStats.peak, "/", DWIN_TX_QUEUE_SIZE,
+      " stalls:", DWIN_TxStats.stalls
+    );
+    if (reset) {
+      DWIN_TxStats = { 0 };
+      DWIN_TxStats.since_ms = ms;
+    }
+  }
+
+#else
+
+  void DWIN_Write(const uint8_t *data, const size_t len) {
+    for (size_t n = 0; n < len; ++n) { LCD_SERIAL.write(data[n]); delayMicroseconds(1); }
+  }
+
+#endif
 
 // Send the data in the buffer plus the packet tail
 void DWIN_Send(size_t &i) {
-  ++i;
-  for (uint8_t n = 0; n < i; ++n) { LCD_SERIAL.write(DWIN_SendBuf[n]); delayMicroseconds(1); }
-  for (uint8_t n = 0; n < 4; ++n) { LCD_SERIAL.write(DWIN_BufTail[n]); delayMicroseconds(1); }
+  DWIN_Write(DWIN_SendBuf, ++i);
+  DWIN_Write(DWIN_BufTail, sizeof(DWIN_BufTail));
+  TERN_(HAS_DWIN_TX_QUEUE, DWIN_TxStats.frames++);
+  DWIN_FrameDirty = true;
 }
 
 /*-------------------------------------- System variable function --------------------------------------*/
@@ -58,6 +130,7 @@ bool DWIN_Handshake() {
   size_t i = 0;
   DWIN_Byte(i, 0x00);
   DWIN_Send(i);
+  DWIN_TxFlush();
   delay(10);
 
   while (LCD_SERIAL.available() > 0 && recnum < (signed)sizeof(databuf)) {
@@ -105,9 +178,11 @@ void DWIN_Frame_SetDir(uint8_t dir) {
 
 // Update display
 void DWIN_UpdateLCD() {
-    size_t i = 0;
-    DWIN_Byte(i, 0x3D);
-    DWIN_Send(i);
+  size_t i = 0;
+  DWIN_Byte(i, 0x3D);
+  DWIN_Send(i);
+  DWIN_FrameDirty = false;
+  DWIN_TxDrain();
 }
 
 /*---------------------------------------- Drawing functions ----------------------------------------*/
@@ -45,6 +45,9 @@ extern uint8_t DWIN_SendBuf[11 + DWIN_WIDTH / 6 * 2];
 extern uint8_t DWIN_BufTail[4];
 extern uint8_t databuf[26];
 
+// Set by any packet sent since the last DWIN_UpdateLCD
+extern bool DWIN_FrameDirty;
+
 inline void DWIN_Byte(size_t &i, const uint16_t bval) {
   DWIN_SendBuf[++i] = bval;
 }
@@ -61,9 +64,31 @@ inline void DWIN_Long(size_t &i, const uint32_t lval) {
   DWIN_SendBuf[++i] = lval & 0xFF;
 }
 
+// Write raw bytes to the display, through the TX queue when enabled
+void DWIN_Write(const uint8_t *data, const size_t len);
+
 // Send the data in the buffer plus the packet tail
 void DWIN_Send(size_t &i);
 
+#if HAS_DWIN_TX_QUEUE
+  typedef struct {
+    uint32_t bytes, frames; // Totals queued since the last reset
+    uint16_t peak;          // Highest queue fill level
+    uint16_t stalls;        // Sends that had to wait for queue space
+    millis_t since_ms;      // Start of the measurement window
+  } dwin_tx_stats_t;
+
+  extern dwin_tx_stats_t DWIN_TxStats;
+
+  // Hand queued bytes to the serial port. Without 'all' only as many as fit in the HAL TX buffer.
+  void DWIN_TxDrain(const bool all=false);
+  inline void DWIN_TxFlush() { DWIN_TxDrain(true); }
+  void DWIN_TxReport(const bool reset=true);
+#else
+  inline void DWIN_TxDrain(const bool=false) {}
+  inline void DWIN_TxFlush() {}
+#endif
+
 inline void DWIN_Text(size_t &i, const char * const string, uint16_t rlimit=0xFFFF) {
   if (!string) return;
   const size_t len = _MIN(sizeof(DWIN_SendBuf) - i, _MIN(strlen(string), rlimit));
@@ -101,6 +101,7 @@ char str_1[16], str_2[16], str_3[16];
 
       bedlevel.z_values[i][j] = mz - lsf_results.D;
     }
+    bedlevel.refresh_bed_level();
     return false;
   }
 
@@ -161,7 +162,9 @@ void BedLevelToolsClass::ProbeXY() {
 
 void BedLevelToolsClass::mesh_reset() {
   ZERO(bedlevel.z_values);
-  TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level();)
+  #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    bedlevel.refresh_bed_level();
+  #endif
 }
 
 // Accessors
@@ -229,6 +232,7 @@ bool BedLevelToolsClass::meshValidate() {
       );
 
       safe_delay(10);
+      DWIN_TxFlush();
       LCD_SERIAL.flushTX();
 
       // Draw value text on
@@ -250,6 +254,7 @@ bool BedLevelToolsClass::meshValidate() {
           DWIN_Draw_String(false, meshfont, Color_White, Color_Bg_Blue, start_x_px + 1 + offset_x, start_y_px + offset_y, buf);
         }
         safe_delay(10);
+        DWIN_TxFlush();
         LCD_SERIAL.flushTX();
       }
     }
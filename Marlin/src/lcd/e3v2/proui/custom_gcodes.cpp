@@ -97,6 +97,11 @@ void C250() {
   }
 #endif
 
+#if HAS_DWIN_TX_QUEUE
+  // Report display transport throughput. S0 keeps the counters running.
+  void C576() { DWIN_TxReport(parser.boolval('S', true)); }
+#endif
+
 #if DEBUG_DWIN
   #include "../../../module/planner.h"
   void C997() {
@@ -122,6 +127,9 @@ void custom_gcode(const int16_t codenum) {
     #if HAS_LOCKSCREEN
       case 510: C510(); break;          // lock screen
     #endif
+    #if HAS_DWIN_TX_QUEUE
+      case 576: C576(); break;          // Report display transport throughput
+    #endif
     #if DEBUG_DWIN
       case 997: C997(); break;          // Simulate a printer freeze
     #endif
@@ -1294,6 +1294,7 @@ void HMI_Init() {
       DWINUI::Draw_Icon(ICON_Bar, 15, 260);
       DWIN_Draw_Rectangle(1, HMI_data.Background_Color, t, 260, 257, 280);
       DWIN_UpdateLCD();
+      DWIN_TxFlush();
       safe_delay((BOOTSCREEN_TIMEOUT) / 22);
     }
   #endif
@@ -1392,7 +1393,7 @@ void EachMomentUpdate() {
       }
     #endif // POWER_LOSS_RECOVERY
   }
-  DWIN_UpdateLCD();
+  DWINUI::UpdateLCD();
 }
 
 #if ENABLED(POWER_LOSS_RECOVERY)
@@ -1459,6 +1460,7 @@ void EachMomentUpdate() {
 
   void UBLSmartFillMesh() {
     for (uint8_t x = 0; x < GRID_MAX_POINTS_X; ++x) bedlevel.smart_fill_mesh();
+    bedlevel.refresh_bed_level();
     LCD_MESSAGE(MSG_UBL_MESH_FILLED);
   }
 
@@ -2074,6 +2076,7 @@ void DWIN_InitScreen() {
   HMI_Init();
   #if PROUI_EX
     DWIN_UpdateLCD();
+    DWIN_TxFlush();
     ProEx.Init();
     safe_delay(2000);
   #endif
@@ -2098,6 +2101,7 @@ void DWIN_InitScreen() {
 }
 
 void MarlinUI::update() {
+  DWIN_TxDrain();       // Feed queued display packets to the UART
   HMI_SDCardUpdate();   // SD card update
   EachMomentUpdate();   // Status update
   DWIN_HandleScreen();  // Rotary encoder update
@@ -2113,6 +2117,7 @@ void MarlinUI::kill_screen(FSTR_P const lcd_error, FSTR_P const lcd_component) {
   DWIN_Draw_Popup(ICON_BLTouch, GET_TEXT_F(MSG_PRINTER_KILLED), lcd_error);
   DWINUI::Draw_CenteredString(HMI_data.PopupTxt_Color, 270, GET_TEXT_F(MSG_TURN_OFF));
   DWIN_UpdateLCD();
+  DWIN_TxFlush();
 }
 
 void DWIN_RebootScreen() {
@@ -2120,6 +2125,7 @@ void DWIN_RebootScreen() {
   DWIN_JPG_ShowAndCache(0);
   DWINUI::Draw_CenteredString(Color_White, 220, GET_TEXT_F(MSG_PLEASE_WAIT_REBOOT));
   DWIN_UpdateLCD();
+  DWIN_TxFlush();
   safe_delay(500);
 }
 
@@ -4115,7 +4121,7 @@ void Draw_GetColor_Menu() {
     #define Z_OFFSET_MAX  3
 
     void LiveEditMesh() { ((MenuItemPtrClass*)EditZValueItem)->value = &bedlevel.z_values[HMI_value.Select ? bedLevelTools.mesh_x : MenuData.Value][HMI_value.Select ? MenuData.Value : bedLevelTools.mesh_y]; EditZValueItem->redraw(); }
-    void LiveEditMeshZ() { *MenuData.P_Float = MenuData.Value / POW(10, 3); if (AutoMovToMesh) { bedLevelTools.MoveToZ(); } }
+    void LiveEditMeshZ() { *MenuData.P_Float = MenuData.Value / POW(10, 3); IF_DISABLED(MESH_BED_LEVELING, bedlevel.refresh_bed_level()); if (AutoMovToMesh) { bedLevelTools.MoveToZ(); } }
     void ApplyEditMeshX() { bedLevelTools.mesh_x = MenuData.Value; if (AutoMovToMesh) { bedLevelTools.MoveToXY(); } }
     void ApplyEditMeshY() { bedLevelTools.mesh_y = MenuData.Value; if (AutoMovToMesh) { bedLevelTools.MoveToXY(); } }
     void ResetMesh() { bedLevelTools.mesh_reset(); EditZValueItem->redraw(); LCD_MESSAGE(MSG_MESH_RESET); }
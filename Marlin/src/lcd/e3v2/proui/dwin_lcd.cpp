@@ -109,10 +109,9 @@ void DWIN_WriteToMem(uint8_t mem, uint16_t addr, uint16_t length, uint8_t *data)
     DWIN_Byte(i, 0x31);
     DWIN_Byte(i, mem);
     DWIN_Word(i, addr + indx); // start address of the data block
-    ++i;
-    for (uint8_t j = 0; j < i; ++j) { LCD_SERIAL.write(DWIN_SendBuf[j]); delayMicroseconds(1); }  // Buf header
-    for (uint16_t j = indx; j <= indx + to_send - 1; j++) { LCD_SERIAL.write(*(data + j)); delayMicroseconds(1); } // write block of data
-    for (uint8_t j = 0; j < 4; ++j) { LCD_SERIAL.write(DWIN_BufTail[j]); delayMicroseconds(1); }
+    DWIN_Write(DWIN_SendBuf, ++i);                  // Buf header
+    DWIN_Write(data + indx, to_send);               // write block of data
+    DWIN_Write(DWIN_BufTail, sizeof(DWIN_BufTail));
     block++;
     pending -= to_send;
   }
@@ -641,4 +641,7 @@ namespace DWINUI {
   // Area (0, TITLE_HEIGHT, DWIN_WIDTH, STATUS_Y - 1)
   void ClearMainArea();
 
+  // Refresh the display only if something was drawn since the last refresh
+  inline void UpdateLCD() { if (DWIN_FrameDirty) DWIN_UpdateLCD(); }
+
 };
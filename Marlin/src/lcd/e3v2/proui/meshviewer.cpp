@@ -76,7 +76,7 @@ void MeshViewerClass::DrawMeshPoint(const uint8_t x, const uint8_t y, const floa
   NOMORE(min, z);
   const uint16_t color = DWINUI::RainbowInt(v, zmin, zmax);
   DWINUI::Draw_FillCircle(color, px(x), py(y), r(v));
-  TERN_(TJC_DISPLAY, delay(100);)
+  TERN_(TJC_DISPLAY, DWIN_TxFlush(); delay(100);)
   if (sizex < (ENABLED(TJC_DISPLAY) ? 8 : 9)) {
     if (v == 0) DWINUI::Draw_Float(meshfont, 1, 2, px(x) - 2*fs, py(y) - fs, 0);
     else DWINUI::Draw_Signed_Float(meshfont, 1, 2, px(x) - 3*fs, py(y) - fs, z);
@@ -110,7 +110,13 @@ void MeshViewerClass::DrawMesh(bed_mesh_t zval, const uint8_t csizex, const uint
   DrawMeshGrid(csizex, csizey);
    for (uint8_t y = 0; y < csizey; ++y) {
     hal.watchdog_refresh();
-     for (uint8_t x = 0; x < csizex; ++x) DrawMeshPoint(x, y, zval[x][y]);
+     for (uint8_t x = 0; x < csizex; ++x) {
+      DrawMeshPoint(x, y, zval[x][y]);
+      #if HAS_PROBE_SPREAD
+        // Ring the points where the probe samples spread too much
+        if (probe_spread[x][y] > (PROBE_BUMP_MAX_STDDEV)) DWINUI::Draw_Circle(HMI_data.AlertTxt_Color, px(x), py(y), rmax);
+      #endif
+    }
   }
 }
 
@@ -76,7 +76,7 @@ void BedMeshEditScreen::onEntry() {
 void BedMeshEditScreen::makeMeshValid() {
   bed_mesh_t &mesh = ExtUI::getMeshArray();
   GRID_LOOP(x, y) {
-    if (isnan(mesh[x][y])) mesh[x][y] = 0;
+    if (isnan(mesh[x][y])) ExtUI::setMeshPoint({ x, y }, 0);
   }
 }
 
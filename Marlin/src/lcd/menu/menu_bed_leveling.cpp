@@ -206,6 +206,9 @@
 #if ENABLED(MESH_EDIT_MENU)
 
   inline void refresh_planner() {
+    #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+      bedlevel.refresh_bed_level();
+    #endif
     set_current_from_steppers_for_axis(ALL_AXES_ENUM);
     sync_plan_position();
   }
@@ -48,6 +48,9 @@ class Canvas {
     static void next();
     static bool toScreen();
 
+    static uint16_t getStartLine() { return startLine; }
+    static uint16_t getEndLine() { return endLine; }
+
     static void setBackground(uint16_t color);
     static void addText(uint16_t x, uint16_t y, uint16_t color, uint16_t *string, uint16_t maxWidth);
     static void addImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors);
@@ -34,6 +34,33 @@ uint8_t *TFT_Queue::current_task = nullptr;
 uint8_t *TFT_Queue::last_task = nullptr;
 uint8_t *TFT_Queue::last_parameter = nullptr;
 
+static_assert(TFT_CANVAS_INDEX_SIZE <= 255, "TFT_CANVAS_INDEX_SIZE must be 255 or less.");
+canvasIndex_t TFT_Queue::canvas_index[TFT_CANVAS_INDEX_SIZE];
+uint8_t TFT_Queue::canvas_order[TFT_CANVAS_INDEX_SIZE];
+uint8_t TFT_Queue::canvas_active[TFT_CANVAS_INDEX_SIZE];
+uint8_t TFT_Queue::canvas_count, TFT_Queue::canvas_pending, TFT_Queue::canvas_active_count;
+
+#if ENABLED(TFT_FRAME_TIME)
+  // Time spent drawing canvas strips, reported as an average over a few seconds
+  static uint32_t frame_us, frames, frames_total_us, frames_max_us;
+  static millis_t next_frame_report_ms;
+
+  static void end_frame() {
+    if (!frame_us) return;
+    frames++;
+    frames_total_us += frame_us;
+    NOLESS(frames_max_us, frame_us);
+    frame_us = 0;
+
+    const millis_t ms = millis();
+    if (ELAPSED(ms, next_frame_report_ms)) {
+      next_frame_report_ms = ms + 5000UL;
+      SERIAL_ECHOLNPGM("TFT frames:", frames, " avg:", frames_total_us / frames, "us max:", frames_max_us, "us");
+      frames = frames_total_us = frames_max_us = 0;
+    }
+  }
+#endif
+
 void TFT_Queue::reset() {
   tft.abort();
 
@@ -58,7 +85,7 @@ void TFT_Queue::async() {
   finish_sketch();
 
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
+    case TASK_END_OF_QUEUE: TERN_(TFT_FRAME_TIME, end_frame()); reset(); break;
     case TASK_FILL:         fill(task);   break;
     case TASK_CANVAS:       canvas(task); break;
   }
@@ -100,46 +127,133 @@ void TFT_Queue::fill(queueTask_t *task) {
 }
 
 void TFT_Queue::canvas(queueTask_t *task) {
-  parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t));
+  TERN_(TFT_FRAME_TIME, const uint32_t start_us = micros());
 
-  uint16_t i;
-  uint8_t *item = ((uint8_t *)task_parameters) + sizeof(parametersCanvas_t);
+  parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t));
 
   if (task->state == TASK_STATE_READY) {
     task->state = TASK_STATE_IN_PROGRESS;
     tftCanvas.instantiate(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
+    if (!index_canvas(task_parameters)) canvas_count = 0;
   }
   tftCanvas.next();
 
-  for (i = 0; i < task_parameters->count; i++) {
+  if (canvas_count)
+    canvas_strip();
+  else {
+    uint8_t *item = ((uint8_t *)task_parameters) + sizeof(parametersCanvas_t);
+    for (uint32_t i = 0; i < task_parameters->count; i++) {
+      canvas_item(item);
+      item = ((parametersCanvasBackground_t *)item)->nextParameter;
+    }
+  }
+
+  if (tftCanvas.toScreen()) task->state = TASK_STATE_COMPLETED;
+
+  TERN_(TFT_FRAME_TIME, frame_us += micros() - start_us);
+}
+
+/**
+ * Find the rows each canvas item can touch and sort the items by their top row.
+ * Bounds are the same ones Canvas uses to clip, so skipped items would draw nothing.
+ * Return false if the canvas has too many items to index.
+ */
+bool TFT_Queue::index_canvas(parametersCanvas_t *task_parameters) {
+  if (task_parameters->count > TFT_CANVAS_INDEX_SIZE) return false;
+
+  canvas_count = task_parameters->count;
+  canvas_pending = canvas_active_count = 0;
+
+  uint8_t *item = ((uint8_t *)task_parameters) + sizeof(parametersCanvas_t);
+  for (uint8_t i = 0; i < canvas_count; i++) {
+    canvasIndex_t &entry = canvas_index[i];
+    entry.item = item;
     switch (*item) {
       case CANVAS_SET_BACKGROUND:
-        tftCanvas.setBackground(((parametersCanvasBackground_t *)item)->color);
+        entry.top = INT16_MIN;
+        entry.bottom = INT16_MAX;
         break;
       case CANVAS_ADD_TEXT:
-        tftCanvas.addText(((parametersCanvasText_t *)item)->x, ((parametersCanvasText_t *)item)->y, ((parametersCanvasText_t *)item)->color, (uint16_t*)(item + sizeof(parametersCanvasText_t)), ((parametersCanvasText_t *)item)->maxWidth);
+        entry.top = ((parametersCanvasText_t *)item)->y;
+        entry.bottom = entry.top + TFT_String::font_height();
         break;
-
       case CANVAS_ADD_IMAGE:
-        MarlinImage image;
-        uint16_t *colors;
-
-        image = ((parametersCanvasImage_t *)item)->image;
-        colors = (uint16_t *)(item + sizeof(parametersCanvasImage_t));
-        tftCanvas.addImage(((parametersCanvasImage_t *)item)->x, ((parametersCanvasImage_t *)item)->y, image, colors);
+        entry.top = ((parametersCanvasImage_t *)item)->y;
+        entry.bottom = entry.top + images[((parametersCanvasImage_t *)item)->image].height - 1;
         break;
-
       case CANVAS_ADD_BAR:
-        tftCanvas.addBar(((parametersCanvasBar_t *)item)->x, ((parametersCanvasBar_t *)item)->y, ((parametersCanvasBar_t *)item)->width, ((parametersCanvasBar_t *)item)->height, ((parametersCanvasBar_t *)item)->color);
+        entry.top = ((parametersCanvasBar_t *)item)->y;
+        entry.bottom = entry.top + ((parametersCanvasBar_t *)item)->height;
         break;
       case CANVAS_ADD_RECT:
-        tftCanvas.addRect(((parametersCanvasRectangle_t *)item)->x, ((parametersCanvasRectangle_t *)item)->y, ((parametersCanvasRectangle_t *)item)->width, ((parametersCanvasRectangle_t *)item)->height, ((parametersCanvasRectangle_t *)item)->color);
+        entry.top = ((parametersCanvasRectangle_t *)item)->y;
+        entry.bottom = entry.top + ((parametersCanvasRectangle_t *)item)->height;
         break;
     }
+
+    // Insertion sort. Screens are mostly queued top to bottom, so this is nearly linear.
+    uint8_t j = i;
+    for (; j && canvas_index[canvas_order[j - 1]].top > entry.top; j--)
+      canvas_order[j] = canvas_order[j - 1];
+    canvas_order[j] = i;
+
     item = ((parametersCanvasBackground_t *)item)->nextParameter;
   }
+  return true;
+}
 
-  if (tftCanvas.toScreen()) task->state = TASK_STATE_COMPLETED;
+/**
+ * Draw the items that touch the current strip, in queue order so overlaps are unchanged.
+ * Strips advance down the canvas, so items start once and are dropped once finished.
+ */
+void TFT_Queue::canvas_strip() {
+  const int16_t startLine = tftCanvas.getStartLine(), endLine = tftCanvas.getEndLine();
+
+  // Start the items whose top row is in or above this strip
+  while (canvas_pending < canvas_count && canvas_index[canvas_order[canvas_pending]].top <= endLine) {
+    const uint8_t n = canvas_order[canvas_pending++];
+    uint8_t j = canvas_active_count++;
+    for (; j && canvas_active[j - 1] > n; j--)
+      canvas_active[j] = canvas_active[j - 1];
+    canvas_active[j] = n;
+  }
+
+  // Draw the started items and drop the ones above this strip
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < canvas_active_count; i++) {
+    const canvasIndex_t &entry = canvas_index[canvas_active[i]];
+    if (entry.bottom < startLine) continue;
+    canvas_item(entry.item);
+    canvas_active[kept++] = canvas_active[i];
+  }
+  canvas_active_count = kept;
+}
+
+void TFT_Queue::canvas_item(uint8_t *item) {
+  switch (*item) {
+    case CANVAS_SET_BACKGROUND:
+      tftCanvas.setBackground(((parametersCanvasBackground_t *)item)->color);
+      break;
+    case CANVAS_ADD_TEXT:
+      tftCanvas.addText(((parametersCanvasText_t *)item)->x, ((parametersCanvasText_t *)item)->y, ((parametersCanvasText_t *)item)->color, (uint16_t*)(item + sizeof(parametersCanvasText_t)), ((parametersCanvasText_t *)item)->maxWidth);
+      break;
+
+    case CANVAS_ADD_IMAGE:
+      MarlinImage image;
+      uint16_t *colors;
+
+      image = ((parametersCanvasImage_t *)item)->image;
+      colors = (uint16_t *)(item + sizeof(parametersCanvasImage_t));
+      tftCanvas.addImage(((parametersCanvasImage_t *)item)->x, ((parametersCanvasImage_t *)item)->y, image, colors);
+      break;
+
+    case CANVAS_ADD_BAR:
+      tftCanvas.addBar(((parametersCanvasBar_t *)item)->x, ((parametersCanvasBar_t *)item)->y, ((parametersCanvasBar_t *)item)->width, ((parametersCanvasBar_t *)item)->height, ((parametersCanvasBar_t *)item)->color);
+      break;
+    case CANVAS_ADD_RECT:
+      tftCanvas.addRect(((parametersCanvasRectangle_t *)item)->x, ((parametersCanvasRectangle_t *)item)->y, ((parametersCanvasRectangle_t *)item)->width, ((parametersCanvasRectangle_t *)item)->height, ((parametersCanvasRectangle_t *)item)->color);
+      break;
+  }
 }
 
 void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
@@ -29,6 +29,12 @@
   #define TFT_QUEUE_SIZE              8192
 #endif
 
+// Canvas items indexed by rows, so each strip only draws the items it touches.
+// Canvases with more items are drawn by walking every item for every strip.
+#ifndef TFT_CANVAS_INDEX_SIZE
+  #define TFT_CANVAS_INDEX_SIZE       64
+#endif
+
 enum QueueTaskType : uint8_t {
   TASK_END_OF_QUEUE = 0x00,
   TASK_FILL,
@@ -118,6 +124,12 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+typedef struct {
+  int16_t top;      // First row the item can touch, relative to the canvas
+  int16_t bottom;   // Last row the item can touch
+  uint8_t *item;
+} canvasIndex_t;
+
 class TFT_Queue {
   private:
     static uint8_t queue[TFT_QUEUE_SIZE];
@@ -126,9 +138,17 @@ class TFT_Queue {
     static uint8_t *last_task;
     static uint8_t *last_parameter;
 
+    static canvasIndex_t canvas_index[TFT_CANVAS_INDEX_SIZE]; // Items in queue order
+    static uint8_t canvas_order[TFT_CANVAS_INDEX_SIZE];       // Item indexes sorted by top row
+    static uint8_t canvas_active[TFT_CANVAS_INDEX_SIZE];      // Started items in queue order
+    static uint8_t canvas_count, canvas_pending, canvas_active_count;
+
     static void finish_sketch();
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
+    static bool index_canvas(parametersCanvas_t *task_parameters);
+    static void canvas_strip();
+    static void canvas_item(uint8_t *item);
     static void handle_queue_overflow(uint16_t sizeNeeded);
 
   public:
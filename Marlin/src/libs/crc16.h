@@ -21,6 +21,15 @@
  */
 #pragma once
 
-#include <stdint.h>
+#include "../inc/MarlinConfigPre.h"
 
+/**
+ * Update a CRC-16/XMODEM (polynomial 0x1021, MSB first) with a block of data.
+ * Feed data in any size pieces; the result is the same as one whole block.
+ */
 void crc16(uint16_t *crc, const void * const data, uint16_t cnt);
+
+#if ENABLED(MARLIN_TEST_BUILD)
+  void crc16_bitwise(uint16_t *crc, const void * const data, uint16_t cnt);
+  void test_crc16();
+#endif
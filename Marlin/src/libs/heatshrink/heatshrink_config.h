@@ -15,7 +15,12 @@
 #else
   // Required parameters for static configuration
   #define HEATSHRINK_STATIC_INPUT_BUFFER_SIZE 32
-  #define HEATSHRINK_STATIC_WINDOW_BITS 8
+  // The window is the largest a host may negotiate. Smaller windows use the same buffer.
+  #ifdef BINARY_STREAM_MAX_WINDOW_BITS
+    #define HEATSHRINK_STATIC_WINDOW_BITS BINARY_STREAM_MAX_WINDOW_BITS
+  #else
+    #define HEATSHRINK_STATIC_WINDOW_BITS 8
+  #endif
   #define HEATSHRINK_STATIC_LOOKAHEAD_BITS 4
 #endif
 
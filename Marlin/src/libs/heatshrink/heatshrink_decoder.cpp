@@ -105,9 +105,29 @@ void heatshrink_decoder_free(heatshrink_decoder *hsd) {
   HEATSHRINK_FREE(hsd, sz);
   (void)sz;   /* may not be used by free */
 }
+
+#else
+bool heatshrink_decoder_configure(heatshrink_decoder *hsd, uint8_t window_sz2, uint8_t lookahead_sz2) {
+  if ((window_sz2 < HEATSHRINK_MIN_WINDOW_BITS) ||
+      (window_sz2 > HEATSHRINK_STATIC_WINDOW_BITS) ||
+      (lookahead_sz2 < HEATSHRINK_MIN_LOOKAHEAD_BITS) ||
+      (lookahead_sz2 >= window_sz2)) {
+      return false;
+  }
+  hsd->window_sz2 = window_sz2;
+  hsd->lookahead_sz2 = lookahead_sz2;
+  heatshrink_decoder_reset(hsd);
+  return true;
+}
 #endif
 
 void heatshrink_decoder_reset(heatshrink_decoder *hsd) {
+  #if !HEATSHRINK_DYNAMIC_ALLOC
+    if (!hsd->window_sz2) {   /* never configured: use the static defaults */
+      hsd->window_sz2 = HEATSHRINK_STATIC_WINDOW_BITS;
+      hsd->lookahead_sz2 = HEATSHRINK_STATIC_LOOKAHEAD_BITS;
+    }
+  #endif
   size_t buf_sz = 1 << HEATSHRINK_DECODER_WINDOW_BITS(hsd);
   size_t input_sz = HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(hsd);
   memset(hsd->buffers, 0, buf_sz + input_sz);
@@ -60,10 +60,10 @@ typedef enum {
 #else
 #define HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(_) \
   HEATSHRINK_STATIC_INPUT_BUFFER_SIZE
-#define HEATSHRINK_DECODER_WINDOW_BITS(_) \
-  (HEATSHRINK_STATIC_WINDOW_BITS)
+#define HEATSHRINK_DECODER_WINDOW_BITS(BUF) \
+  ((BUF)->window_sz2)
 #define HEATSHRINK_DECODER_LOOKAHEAD_BITS(BUF) \
-  (HEATSHRINK_STATIC_LOOKAHEAD_BITS)
+  ((BUF)->lookahead_sz2)
 #endif
 
 typedef struct {
@@ -85,8 +85,12 @@ typedef struct {
   /* Input buffer, then expansion window buffer */
   uint8_t buffers[];
 #else
+  /* Parameters set at runtime, up to the static buffer size */
+  uint8_t window_sz2;         /* window buffer bits */
+  uint8_t lookahead_sz2;      /* lookahead bits */
+
   /* Input buffer, then expansion window buffer */
-  uint8_t buffers[(1 << HEATSHRINK_DECODER_WINDOW_BITS(_)) + HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(_)];
+  uint8_t buffers[(1 << HEATSHRINK_STATIC_WINDOW_BITS) + HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(_)];
 #endif
 } heatshrink_decoder;
 
@@ -102,6 +106,13 @@ heatshrink_decoder *heatshrink_decoder_alloc(uint16_t input_buffer_size, uint8_t
 void heatshrink_decoder_free(heatshrink_decoder *hsd);
 #endif
 
+#if !HEATSHRINK_DYNAMIC_ALLOC
+/* Set the window and lookahead sizes of a static decoder to match the
+ * settings used for compression, then reset it. WINDOW_SZ2 may not exceed
+ * HEATSHRINK_STATIC_WINDOW_BITS. Returns false if the sizes are invalid. */
+bool heatshrink_decoder_configure(heatshrink_decoder *hsd, uint8_t window_sz2, uint8_t lookahead_sz2);
+#endif
+
 /* Reset a decoder. */
 void heatshrink_decoder_reset(heatshrink_decoder *hsd);
 
@@ -51,9 +51,14 @@ FxdTiCtrl fxdTiCtrl;
 // Public variables.
 
 ft_config_t FxdTiCtrl::cfg;
-ft_command_t FxdTiCtrl::stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE] = {0U};                // Buffer of stepper commands.
-hal_timer_t FxdTiCtrl::stepperCmdBuff_StepRelativeTi[FTM_STEPPERCMD_BUFF_SIZE] = {0U};  // Buffer of the stepper command timing.
-uint8_t FxdTiCtrl::stepperCmdBuff_ApplyDir[FTM_STEPPERCMD_DIR_SIZE] = {0U};             // Buffer of whether DIR needs to be updated.
+#if ENABLED(FTM_COMPACT_BUFFERS)
+  ft_packed_cmd_t FxdTiCtrl::stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE] = {0U};             // Buffer of packed stepper commands.
+  static_assert((FTM_MIN_TICKS) <= (FT_PACKED_TICKS_MAX), "FTM_COMPACT_BUFFERS needs FTM_MIN_TICKS to fit in 16 bits. Increase FTM_STEPPER_FS.");
+#else
+  ft_command_t FxdTiCtrl::stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE] = {0U};                // Buffer of stepper commands.
+  hal_timer_t FxdTiCtrl::stepperCmdBuff_StepRelativeTi[FTM_STEPPERCMD_BUFF_SIZE] = {0U};  // Buffer of the stepper command timing.
+  uint8_t FxdTiCtrl::stepperCmdBuff_ApplyDir[FTM_STEPPERCMD_DIR_SIZE] = {0U};             // Buffer of whether DIR needs to be updated.
+#endif
 uint32_t FxdTiCtrl::stepperCmdBuff_produceIdx = 0,  // Index of next stepper command write to the buffer.
          FxdTiCtrl::stepperCmdBuff_consumeIdx = 0;  // Index of next stepper command read from the buffer.
 
@@ -62,7 +67,9 @@ bool FxdTiCtrl::sts_stepperBusy = false;          // The stepper buffer has item
 // Private variables.
 // NOTE: These are sized for Ulendo FBS use.
 xyze_trajectory_t FxdTiCtrl::traj;                // = {0.0f} Storage for fixed-time-based trajectory.
-xyze_trajectoryMod_t FxdTiCtrl::trajMod;          // = {0.0f} Storage for modified fixed-time-based trajectory.
+#if DISABLED(FTM_COMPACT_BUFFERS)
+  xyze_trajectoryMod_t FxdTiCtrl::trajMod;        // = {0.0f} Storage for modified fixed-time-based trajectory.
+#endif
 
 block_t* FxdTiCtrl::current_block_cpy = nullptr;  // Pointer to current block being processed.
 bool FxdTiCtrl::blockProcRdy = false,             // Indicates a block is ready to be processed.
@@ -94,6 +101,23 @@ uint32_t FxdTiCtrl::N1,                         // Number of data points in the
 
 uint32_t FxdTiCtrl::max_intervals;              // Total number of data points that will be generated from block.
 
+#if ENABLED(FTM_FIXED_POINT)
+  // Fixed-point trajectory variables.
+  xyze_long_t FxdTiCtrl::endSteps_prevBlock = { 0 };  // (steps) End position of previous block
+  xyze_float_t FxdTiCtrl::ratio_steps;                // (steps/mm) Axis steps per mm along the block
+  int64_t FxdTiCtrl::fxp_start[LOGICAL_AXES],         // (steps << 32) Start position of block
+          FxdTiCtrl::fxp_pos[LOGICAL_AXES],           // (steps << 32) Position of the next point
+          FxdTiCtrl::fxp_vel[LOGICAL_AXES],           // (steps << 32) Change to the point after that
+          FxdTiCtrl::fxp_acc[LOGICAL_AXES];           // (steps << 32) Change of fxp_vel per point
+  #if HAS_EXTRUDERS
+    int64_t FxdTiCtrl::fxp_e_raw_z1 = 0,              // (steps << 32) Unit delay of raw extruder position
+            FxdTiCtrl::fxp_e_advanced_z1 = 0,         // (steps << 32) Unit delay of advanced extruder position
+            FxdTiCtrl::fxp_la_adj = 0;                // (steps << 32) Linear advance added per point
+  #endif
+
+  constexpr float fxp_one = 4294967296.0f;            // 1 << 32
+#endif
+
 // Make vector variables.
 uint32_t FxdTiCtrl::makeVector_idx = 0,                     // Index of fixed time trajectory generation of the overall block.
          FxdTiCtrl::makeVector_idx_z1 = 0,                  // Storage for the previously calculated index above.
@@ -111,9 +135,9 @@ hal_timer_t FxdTiCtrl::nextStepTicks = FTM_MIN_TICKS; // Accumulator for the nex
 #if HAS_X_AXIS
   FxdTiCtrl::shaping_t FxdTiCtrl::shaping = {
     0, 0,
-    x:{ { 0.0f }, { 0.0f }, { 0 } },                  // d_zi, Ai, Ni
+    x:{ { 0 }, { 0.0f }, { 0 } },                     // d_zi, Ai, Ni
     #if HAS_Y_AXIS
-      y:{ { 0.0f }, { 0.0f }, { 0 } }                 // d_zi, Ai, Ni
+      y:{ { 0 }, { 0.0f }, { 0 } }                    // d_zi, Ai, Ni
     #endif
   };
 #endif
@@ -222,6 +246,14 @@ void FxdTiCtrl::loop() {
 
     // Call Ulendo FBS here.
 
+  #if ENABLED(FTM_COMPACT_BUFFERS)
+
+    // The upper half of the window is converted in place, so point
+    // generation waits for interpolation to finish with the batch.
+    batchRdyForInterp = true;
+
+  #else
+
     // Copy the uncompensated vectors. (XY done, other axes uncompensated)
     LOGICAL_AXIS_CODE(
       memcpy(trajMod.e, &traj.e[FTM_BATCH_SIZE], sizeof(trajMod.e)),
@@ -248,6 +280,8 @@ void FxdTiCtrl::loop() {
 
     batchRdy = false; // Clear so that makeVector() may resume generating points.
 
+  #endif
+
   } // if (batchRdy && !batchRdyForInterp)
 
   // Interpolation.
@@ -260,6 +294,13 @@ void FxdTiCtrl::loop() {
     if (++interpIdx == FTM_BATCH_SIZE) {
       batchRdyForInterp = false;
       interpIdx = 0;
+
+      #if ENABLED(FTM_COMPACT_BUFFERS)
+        // Shift the time series back in the window for (shaped) X and Y
+        TERN_(HAS_X_AXIS, memcpy(traj.x, &traj.x[FTM_BATCH_SIZE], sizeof(traj.x) / 2));
+        TERN_(HAS_Y_AXIS, memcpy(traj.y, &traj.y[FTM_BATCH_SIZE], sizeof(traj.y) / 2));
+        batchRdy = false; // Clear so that makeVector() may resume generating points.
+      #endif
     }
   }
 
@@ -343,6 +384,14 @@ void FxdTiCtrl::loop() {
     #if HAS_Y_AXIS
       memcpy(y.Ai, x.Ai, sizeof(x.Ai)); // For now, zeta and vtol are shared across x and y.
     #endif
+
+    #if ENABLED(FTM_FIXED_POINT)
+      // Round the gains to 30 fractional bits, keeping their sum exactly 1 so a still axis stays put
+      int32_t sum = 0;
+      for (uint32_t i = 1U; i <= max_i; i++) sum += (x.Ai_q[i] = int32_t(lroundf(x.Ai[i] * float(_BV32(30)))));
+      x.Ai_q[0] = int32_t(_BV32(30)) - sum;
+      TERN_(HAS_Y_AXIS, memcpy(y.Ai_q, x.Ai_q, sizeof(x.Ai_q)));
+    #endif
   }
 
   void FxdTiCtrl::updateShapingA(const_float_t zeta/*=FTM_SHAPING_ZETA*/, const_float_t vtol/*=FTM_SHAPING_V_TOL*/) {
@@ -396,7 +445,9 @@ void FxdTiCtrl::reset() {
   stepperCmdBuff_produceIdx = stepperCmdBuff_consumeIdx = 0;
 
   traj.reset(); // Reset trajectory history
-  trajMod.reset(); // Reset modified trajectory history
+  #if DISABLED(FTM_COMPACT_BUFFERS)
+    trajMod.reset(); // Reset modified trajectory history
+  #endif
 
   blockProcRdy = blockProcRdy_z1 = blockProcDn = false;
   batchRdy = batchRdyForInterp = false;
@@ -404,6 +455,7 @@ void FxdTiCtrl::reset() {
   runout = false;
 
   endPosn_prevBlock.reset();
+  TERN_(FTM_FIXED_POINT, endSteps_prevBlock.reset());
 
   makeVector_idx = makeVector_idx_z1 = 0;
   makeVector_batchIdx = FTM_BATCH_SIZE;
@@ -415,11 +467,14 @@ void FxdTiCtrl::reset() {
 
   #if HAS_X_AXIS
     for (uint32_t i = 0U; i < (FTM_ZMAX); i++)
-      shaping.x.d_zi[i] = TERN_(HAS_Y_AXIS, shaping.y.d_zi[i] =) 0.0f;
+      shaping.x.d_zi[i] = TERN_(HAS_Y_AXIS, shaping.y.d_zi[i] =) 0;
     shaping.zi_idx = 0;
   #endif
 
   TERN_(HAS_EXTRUDERS, e_raw_z1 = e_advanced_z1 = 0.0f);
+  #if ALL(FTM_FIXED_POINT, HAS_EXTRUDERS)
+    fxp_e_raw_z1 = fxp_e_advanced_z1 = 0;
+  #endif
 }
 
 // Private functions.
@@ -533,59 +588,136 @@ void FxdTiCtrl::loadBlockData(block_t * const current_block) {
   max_intervals = N1 + N2 + N3 - 1U;
 
   endPosn_prevBlock += moveDist;
+
+  #if ENABLED(FTM_FIXED_POINT)
+    // Track whole steps so block start positions stay exact however long the print
+    const xyze_long_t moveSteps = LOGICAL_AXIS_ARRAY(
+      direction.e ? int32_t(current_block->steps.e) : -int32_t(current_block->steps.e),
+      direction.x ? int32_t(current_block->steps.x) : -int32_t(current_block->steps.x),
+      direction.y ? int32_t(current_block->steps.y) : -int32_t(current_block->steps.y),
+      direction.z ? int32_t(current_block->steps.z) : -int32_t(current_block->steps.z),
+      direction.i ? int32_t(current_block->steps.i) : -int32_t(current_block->steps.i),
+      direction.j ? int32_t(current_block->steps.j) : -int32_t(current_block->steps.j),
+      direction.k ? int32_t(current_block->steps.k) : -int32_t(current_block->steps.k),
+      direction.u ? int32_t(current_block->steps.u) : -int32_t(current_block->steps.u),
+      direction.v ? int32_t(current_block->steps.v) : -int32_t(current_block->steps.v),
+      direction.w ? int32_t(current_block->steps.w) : -int32_t(current_block->steps.w)
+    );
+    LOOP_LOGICAL_AXES(a) {
+      fxp_start[a] = int64_t(endSteps_prevBlock[a]) * 0x100000000LL;
+      ratio_steps[a] = moveSteps[a] * oneOverLength;
+    }
+    endSteps_prevBlock += moveSteps;
+  #endif
 }
 
+#if ENABLED(FTM_FIXED_POINT)
+
+  // Set up forward differencing for the trapezoid phase that begins at makeVector_idx.
+  // With u points into the phase, dist(u) = D0 + V*Ts*u + A/2*(Ts*u)^2.
+  void FxdTiCtrl::startPhase() {
+    float D0, V, A;
+    if (makeVector_idx < N1)           { D0 = 0.0f; V = f_s; A = accel_P; } // Acceleration phase
+    else if (makeVector_idx < N1 + N2) { D0 = s_1e; V = F_P; A = 0.0f;    } // Coasting phase
+    else                               { D0 = s_2e; V = F_P; A = decel_P; } // Deceleration phase
+
+    const float vt = V * (FTM_TS), at2 = A * sq(FTM_TS),
+                dist = D0 + vt + 0.5f * at2,  // (mm) First point of the phase
+                ddist = vt + 1.5f * at2;      // (mm) From the first to the second point
+
+    LOOP_LOGICAL_AXES(a) {
+      const float r = ratio_steps[a] * fxp_one;
+      fxp_pos[a] = fxp_start[a] + int64_t(r * dist);
+      fxp_vel[a] = int64_t(r * ddist);
+      fxp_acc[a] = int64_t(r * at2);
+    }
+
+    #if HAS_EXTRUDERS
+      fxp_la_adj = ratio.e > 0.0f
+        ? int64_t(A * cfg.linearAdvK * (FTM_TS) * planner.settings.axis_steps_per_mm[E_AXIS_N(current_block_cpy->extruder)] * fxp_one)
+        : 0;
+    #endif
+  }
+
+#endif // FTM_FIXED_POINT
+
 // Generate data points of the trajectory.
 void FxdTiCtrl::makeVector() {
-  float accel_k = 0.0f;                                   // (mm/s^2) Acceleration K factor
-  float tau = (makeVector_idx + 1) * (FTM_TS);            // (s) Time since start of block
-  float dist = 0.0f;                                      // (mm) Distance traveled
-
-  if (makeVector_idx < N1) {
-    // Acceleration phase
-    dist = (f_s * tau) + (0.5f * accel_P * sq(tau));      // (mm) Distance traveled for acceleration phase
-    accel_k = accel_P;                                    // (mm/s^2) Acceleration K factor from Accel phase
-  }
-  else if (makeVector_idx >= N1 && makeVector_idx < (N1 + N2)) {
-    // Coasting phase
-    dist = s_1e + F_P * (tau - N1 * (FTM_TS));            // (mm) Distance traveled for coasting phase
-    //accel_k = 0.0f;
-  }
-  else {
-    // Deceleration phase
-    const float tau_ = tau - (N1 + N2) * (FTM_TS);        // (s) Time since start of decel phase
-    dist = s_2e + F_P * tau_ + 0.5f * decel_P * sq(tau_); // (mm) Distance traveled for deceleration phase
-    accel_k = decel_P;                                    // (mm/s^2) Acceleration K factor from Decel phase
-  }
 
-  NUM_AXIS_CODE(
-    traj.x[makeVector_batchIdx] = startPosn.x + ratio.x * dist,
-    traj.y[makeVector_batchIdx] = startPosn.y + ratio.y * dist,
-    traj.z[makeVector_batchIdx] = startPosn.z + ratio.z * dist,
-    traj.i[makeVector_batchIdx] = startPosn.i + ratio.i * dist,
-    traj.j[makeVector_batchIdx] = startPosn.j + ratio.j * dist,
-    traj.k[makeVector_batchIdx] = startPosn.k + ratio.k * dist,
-    traj.u[makeVector_batchIdx] = startPosn.u + ratio.u * dist,
-    traj.v[makeVector_batchIdx] = startPosn.v + ratio.v * dist,
-    traj.w[makeVector_batchIdx] = startPosn.w + ratio.w * dist
-  );
+  #if ENABLED(FTM_FIXED_POINT)
 
-  #if HAS_EXTRUDERS
-    const float new_raw_z1 = startPosn.e + ratio.e * dist;
-    if (cfg.linearAdvEna) {
-      float dedt_adj = (new_raw_z1 - e_raw_z1) * (FTM_FS);
-      if (ratio.e > 0.0f) dedt_adj += accel_k * cfg.linearAdvK;
+    if (makeVector_idx == 0 || makeVector_idx == N1 || makeVector_idx == N1 + N2) startPhase();
+
+    TERN_(HAS_EXTRUDERS, const int64_t new_raw_z1 = fxp_pos[E_AXIS]);
+
+    // Store the point and step all axes on to the next
+    LOOP_LOGICAL_AXES(a) {
+      traj.data[a][makeVector_batchIdx] = ft_pos_t(fxp_pos[a] >> (32 - (FTM_POS_FRAC_BITS)));
+      fxp_pos[a] += fxp_vel[a];
+      fxp_vel[a] += fxp_acc[a];
+    }
+
+    #if HAS_EXTRUDERS
+      if (cfg.linearAdvEna) {
+        fxp_e_advanced_z1 += new_raw_z1 - fxp_e_raw_z1 + fxp_la_adj;
+        traj.e[makeVector_batchIdx] = ft_pos_t(fxp_e_advanced_z1 >> (32 - (FTM_POS_FRAC_BITS)));
+        fxp_e_raw_z1 = new_raw_z1;
+      }
+    #endif
 
-      e_advanced_z1 += dedt_adj * (FTM_TS);
-      traj.e[makeVector_batchIdx] = e_advanced_z1;
+  #else // !FTM_FIXED_POINT
 
-      e_raw_z1 = new_raw_z1;
+    float accel_k = 0.0f;                                   // (mm/s^2) Acceleration K factor
+    float tau = (makeVector_idx + 1) * (FTM_TS);            // (s) Time since start of block
+    float dist = 0.0f;                                      // (mm) Distance traveled
+
+    if (makeVector_idx < N1) {
+      // Acceleration phase
+      dist = (f_s * tau) + (0.5f * accel_P * sq(tau));      // (mm) Distance traveled for acceleration phase
+      accel_k = accel_P;                                    // (mm/s^2) Acceleration K factor from Accel phase
+    }
+    else if (makeVector_idx >= N1 && makeVector_idx < (N1 + N2)) {
+      // Coasting phase
+      dist = s_1e + F_P * (tau - N1 * (FTM_TS));            // (mm) Distance traveled for coasting phase
+      //accel_k = 0.0f;
     }
     else {
-      traj.e[makeVector_batchIdx] = new_raw_z1;
-      // Alternatively: ed[makeVector_batchIdx] = startPosn.e + (ratio.e * dist) / (N1 + N2 + N3);
+      // Deceleration phase
+      const float tau_ = tau - (N1 + N2) * (FTM_TS);        // (s) Time since start of decel phase
+      dist = s_2e + F_P * tau_ + 0.5f * decel_P * sq(tau_); // (mm) Distance traveled for deceleration phase
+      accel_k = decel_P;                                    // (mm/s^2) Acceleration K factor from Decel phase
     }
-  #endif
+
+    NUM_AXIS_CODE(
+      traj.x[makeVector_batchIdx] = startPosn.x + ratio.x * dist,
+      traj.y[makeVector_batchIdx] = startPosn.y + ratio.y * dist,
+      traj.z[makeVector_batchIdx] = startPosn.z + ratio.z * dist,
+      traj.i[makeVector_batchIdx] = startPosn.i + ratio.i * dist,
+      traj.j[makeVector_batchIdx] = startPosn.j + ratio.j * dist,
+      traj.k[makeVector_batchIdx] = startPosn.k + ratio.k * dist,
+      traj.u[makeVector_batchIdx] = startPosn.u + ratio.u * dist,
+      traj.v[makeVector_batchIdx] = startPosn.v + ratio.v * dist,
+      traj.w[makeVector_batchIdx] = startPosn.w + ratio.w * dist
+    );
+
+    #if HAS_EXTRUDERS
+      const float new_raw_z1 = startPosn.e + ratio.e * dist;
+      if (cfg.linearAdvEna) {
+        float dedt_adj = (new_raw_z1 - e_raw_z1) * (FTM_FS);
+        if (ratio.e > 0.0f) dedt_adj += accel_k * cfg.linearAdvK;
+
+        e_advanced_z1 += dedt_adj * (FTM_TS);
+        traj.e[makeVector_batchIdx] = e_advanced_z1;
+
+        e_raw_z1 = new_raw_z1;
+      }
+      else {
+        traj.e[makeVector_batchIdx] = new_raw_z1;
+        // Alternatively: ed[makeVector_batchIdx] = startPosn.e + (ratio.e * dist) / (N1 + N2 + N3);
+      }
+    #endif
+
+  #endif // !FTM_FIXED_POINT
 
   // Update shaping parameters if needed.
   #if HAS_DYNAMIC_FREQ_MM
@@ -594,23 +726,25 @@ void FxdTiCtrl::makeVector() {
   switch (cfg.dynFreqMode) {
 
     #if HAS_DYNAMIC_FREQ_MM
-      case dynFreqMode_Z_BASED:
-        if (traj.z[makeVector_batchIdx] != zd_z1) { // Only update if Z changed.
-          const float xf = cfg.baseFreq[X_AXIS] + cfg.dynFreqK[X_AXIS] * traj.z[makeVector_batchIdx],
-                      yf = cfg.baseFreq[Y_AXIS] + cfg.dynFreqK[Y_AXIS] * traj.z[makeVector_batchIdx];
+      case dynFreqMode_Z_BASED: {
+        const float zd = TERN(FTM_FIXED_POINT, traj.z[makeVector_batchIdx] * (planner.mm_per_step[Z_AXIS] / _BV(FTM_POS_FRAC_BITS)), traj.z[makeVector_batchIdx]);
+        if (zd != zd_z1) { // Only update if Z changed.
+          const float xf = cfg.baseFreq[X_AXIS] + cfg.dynFreqK[X_AXIS] * zd,
+                      yf = cfg.baseFreq[Y_AXIS] + cfg.dynFreqK[Y_AXIS] * zd;
           updateShapingN(_MAX(xf, FTM_MIN_SHAPE_FREQ), _MAX(yf, FTM_MIN_SHAPE_FREQ));
-          zd_z1 = traj.z[makeVector_batchIdx];
+          zd_z1 = zd;
         }
-        break;
+      } break;
     #endif
 
     #if HAS_DYNAMIC_FREQ_G
-      case dynFreqMode_MASS_BASED:
+      case dynFreqMode_MASS_BASED: {
         // Update constantly. The optimization done for Z value makes
         // less sense for E, as E is expected to constantly change.
-        updateShapingN(      cfg.baseFreq[X_AXIS] + cfg.dynFreqK[X_AXIS] * traj.e[makeVector_batchIdx]
-          OPTARG(HAS_Y_AXIS, cfg.baseFreq[Y_AXIS] + cfg.dynFreqK[Y_AXIS] * traj.e[makeVector_batchIdx]) );
-        break;
+        const float ed = TERN(FTM_FIXED_POINT, traj.e[makeVector_batchIdx] * (planner.mm_per_step[E_AXIS_N(current_block_cpy->extruder)] / _BV(FTM_POS_FRAC_BITS)), traj.e[makeVector_batchIdx]);
+        updateShapingN(      cfg.baseFreq[X_AXIS] + cfg.dynFreqK[X_AXIS] * ed
+          OPTARG(HAS_Y_AXIS, cfg.baseFreq[Y_AXIS] + cfg.dynFreqK[Y_AXIS] * ed) );
+      } break;
     #endif
 
     default: break;
@@ -619,6 +753,20 @@ void FxdTiCtrl::makeVector() {
   // Apply shaping if in mode.
   #if HAS_X_AXIS
     if (cfg.modeHasShaper()) {
+      #if ENABLED(FTM_FIXED_POINT)
+        // Integer FIR with 30-bit gains and a 64-bit accumulator
+        auto shape = [](axis_shaping_t &sh, ft_pos_t &pos) {
+          sh.d_zi[shaping.zi_idx] = pos;
+          int64_t acc = int64_t(sh.Ai_q[0]) * pos;
+          for (uint32_t i = 1U; i <= shaping.max_i; i++) {
+            const uint32_t udiff = shaping.zi_idx - sh.Ni[i];
+            acc += int64_t(sh.Ai_q[i]) * sh.d_zi[sh.Ni[i] > shaping.zi_idx ? (FTM_ZMAX) + udiff : udiff];
+          }
+          pos = ft_pos_t((acc + _BV32(29)) >> 30);
+        };
+        shape(shaping.x, traj.x[makeVector_batchIdx]);
+        TERN_(HAS_Y_AXIS, shape(shaping.y, traj.y[makeVector_batchIdx]));
+      #else
       shaping.x.d_zi[shaping.zi_idx] = traj.x[makeVector_batchIdx];
       traj.x[makeVector_batchIdx] *= shaping.x.Ai[0];
       #if HAS_Y_AXIS
@@ -633,6 +781,7 @@ void FxdTiCtrl::makeVector() {
           traj.y[makeVector_batchIdx] += shaping.y.Ai[i] * shaping.y.d_zi[shaping.y.Ni[i] > shaping.zi_idx ? (FTM_ZMAX) + udiffy : udiffy];
         #endif
       }
+      #endif
       if (++shaping.zi_idx == (FTM_ZMAX)) shaping.zi_idx = 0;
     }
   #endif
@@ -653,11 +802,36 @@ void FxdTiCtrl::makeVector() {
 }
 
 // Interpolates single data point to stepper commands.
-void FxdTiCtrl::convertToSteps(const uint32_t idx) {
+void FxdTiCtrl::convertToSteps(const uint32_t batchIdx) {
   xyze_long_t err_P = { 0 };
 
+  #if ENABLED(FTM_COMPACT_BUFFERS)
+    // The batch is in the upper half of the window
+    const uint32_t idx = (FTM_BATCH_SIZE) + batchIdx;
+    const xyze_trajectory_t &trajMod = traj;
+  #else
+    const uint32_t idx = batchIdx;
+  #endif
+
   //#define STEPS_ROUNDING
-  #if ENABLED(STEPS_ROUNDING)
+  #if ENABLED(FTM_FIXED_POINT)
+    // Trajectory points are already in steps
+    auto to_steps = [](const ft_pos_t p) -> int32_t {
+      return (p + TERN0(STEPS_ROUNDING, _BV(FTM_POS_FRAC_BITS - 1))) >> (FTM_POS_FRAC_BITS);
+    };
+    xyze_long_t delta = LOGICAL_AXIS_ARRAY(
+      to_steps(trajMod.e[idx]) - steps.e,
+      to_steps(trajMod.x[idx]) - steps.x,
+      to_steps(trajMod.y[idx]) - steps.y,
+      to_steps(trajMod.z[idx]) - steps.z,
+      to_steps(trajMod.i[idx]) - steps.i,
+      to_steps(trajMod.j[idx]) - steps.j,
+      to_steps(trajMod.k[idx]) - steps.k,
+      to_steps(trajMod.u[idx]) - steps.u,
+      to_steps(trajMod.v[idx]) - steps.v,
+      to_steps(trajMod.w[idx]) - steps.w
+    );
+  #elif ENABLED(STEPS_ROUNDING)
     const xyze_float_t steps_tar = LOGICAL_AXIS_ARRAY(
       trajMod.e[idx] * planner.settings.axis_steps_per_mm[E_AXIS_N(current_block->extruder)] + (trajMod.e[idx] < 0.0f ? -0.5f : 0.5f), // May be eliminated if guaranteed positive.
       trajMod.x[idx] * planner.settings.axis_steps_per_mm[X_AXIS] + (trajMod.x[idx] < 0.0f ? -0.5f : 0.5f),
@@ -748,65 +922,188 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
     };
 
     // Init all step/dir bits to 0 (defaulting to reverse/negative motion)
-    stepperCmdBuff[stepperCmdBuff_produceIdx] = 0;
+    ft_command_t command = 0;
 
     // Set up step/dir bits for all axes
     LOGICAL_AXIS_CODE(
-      COMMAND_SET(delta.e, err_P.e, steps.e, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_E), _BV(FT_BIT_STEP_E)),
-      COMMAND_SET(delta.x, err_P.x, steps.x, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_X), _BV(FT_BIT_STEP_X)),
-      COMMAND_SET(delta.y, err_P.y, steps.y, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_Y), _BV(FT_BIT_STEP_Y)),
-      COMMAND_SET(delta.z, err_P.z, steps.z, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_Z), _BV(FT_BIT_STEP_Z)),
-      COMMAND_SET(delta.i, err_P.i, steps.i, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_I), _BV(FT_BIT_STEP_I)),
-      COMMAND_SET(delta.j, err_P.j, steps.j, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_J), _BV(FT_BIT_STEP_J)),
-      COMMAND_SET(delta.k, err_P.k, steps.k, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_K), _BV(FT_BIT_STEP_K)),
-      COMMAND_SET(delta.u, err_P.u, steps.u, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_U), _BV(FT_BIT_STEP_U)),
-      COMMAND_SET(delta.v, err_P.v, steps.v, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_V), _BV(FT_BIT_STEP_V)),
-      COMMAND_SET(delta.w, err_P.w, steps.w, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_W), _BV(FT_BIT_STEP_W)),
+      COMMAND_SET(delta.e, err_P.e, steps.e, command, _BV(FT_BIT_DIR_E), _BV(FT_BIT_STEP_E)),
+      COMMAND_SET(delta.x, err_P.x, steps.x, command, _BV(FT_BIT_DIR_X), _BV(FT_BIT_STEP_X)),
+      COMMAND_SET(delta.y, err_P.y, steps.y, command, _BV(FT_BIT_DIR_Y), _BV(FT_BIT_STEP_Y)),
+      COMMAND_SET(delta.z, err_P.z, steps.z, command, _BV(FT_BIT_DIR_Z), _BV(FT_BIT_STEP_Z)),
+      COMMAND_SET(delta.i, err_P.i, steps.i, command, _BV(FT_BIT_DIR_I), _BV(FT_BIT_STEP_I)),
+      COMMAND_SET(delta.j, err_P.j, steps.j, command, _BV(FT_BIT_DIR_J), _BV(FT_BIT_STEP_J)),
+      COMMAND_SET(delta.k, err_P.k, steps.k, command, _BV(FT_BIT_DIR_K), _BV(FT_BIT_STEP_K)),
+      COMMAND_SET(delta.u, err_P.u, steps.u, command, _BV(FT_BIT_DIR_U), _BV(FT_BIT_STEP_U)),
+      COMMAND_SET(delta.v, err_P.v, steps.v, command, _BV(FT_BIT_DIR_V), _BV(FT_BIT_STEP_V)),
+      COMMAND_SET(delta.w, err_P.w, steps.w, command, _BV(FT_BIT_DIR_W), _BV(FT_BIT_STEP_W)),
     );
 
+    auto next_cmd = []{
+      if (stepperCmdBuff_produceIdx == (FTM_STEPPERCMD_BUFF_SIZE) - 1)
+        stepperCmdBuff_produceIdx = 0;
+      else
+        stepperCmdBuff_produceIdx++;
+    };
+
     if (!anyStep) {
+      #if ENABLED(FTM_COMPACT_BUFFERS)
+        // Packed commands only have 16 bits for ticks, so break up long pauses with empty commands
+        if (nextStepTicks > (FT_PACKED_TICKS_MAX) - (FTM_MIN_TICKS)) {
+          stepperCmdBuff[stepperCmdBuff_produceIdx] = nextStepTicks;
+          next_cmd();
+          nextStepTicks = 0;
+        }
+      #endif
       nextStepTicks += (FTM_MIN_TICKS);
     }
     else {
-      stepperCmdBuff_StepRelativeTi[stepperCmdBuff_produceIdx] = nextStepTicks;
-
-      const uint8_t dir_index = stepperCmdBuff_produceIdx >> 3,
-                    dir_bit = stepperCmdBuff_produceIdx & 0x7;
+      const bool applyDir = any_dirChange;
       if (any_dirChange) {
 
-        SBI(stepperCmdBuff_ApplyDir[dir_index], dir_bit);
-
         auto DIR_SET = [&](auto &d, auto &c, auto &b, auto bd) {
           if (d > 0) { b |= bd; c = stepDirState_POS; } else { c = stepDirState_NEG; }
         };
 
         LOGICAL_AXIS_CODE(
-          DIR_SET(delta.e, dirState.e, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_E)),
-          DIR_SET(delta.x, dirState.x, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_X)),
-          DIR_SET(delta.y, dirState.y, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_Y)),
-          DIR_SET(delta.z, dirState.z, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_Z)),
-          DIR_SET(delta.i, dirState.i, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_I)),
-          DIR_SET(delta.j, dirState.j, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_J)),
-          DIR_SET(delta.k, dirState.k, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_K)),
-          DIR_SET(delta.u, dirState.u, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_U)),
-          DIR_SET(delta.v, dirState.v, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_V)),
-          DIR_SET(delta.w, dirState.w, stepperCmdBuff[stepperCmdBuff_produceIdx], _BV(FT_BIT_DIR_W)),
+          DIR_SET(delta.e, dirState.e, command, _BV(FT_BIT_DIR_E)),
+          DIR_SET(delta.x, dirState.x, command, _BV(FT_BIT_DIR_X)),
+          DIR_SET(delta.y, dirState.y, command, _BV(FT_BIT_DIR_Y)),
+          DIR_SET(delta.z, dirState.z, command, _BV(FT_BIT_DIR_Z)),
+          DIR_SET(delta.i, dirState.i, command, _BV(FT_BIT_DIR_I)),
+          DIR_SET(delta.j, dirState.j, command, _BV(FT_BIT_DIR_J)),
+          DIR_SET(delta.k, dirState.k, command, _BV(FT_BIT_DIR_K)),
+          DIR_SET(delta.u, dirState.u, command, _BV(FT_BIT_DIR_U)),
+          DIR_SET(delta.v, dirState.v, command, _BV(FT_BIT_DIR_V)),
+          DIR_SET(delta.w, dirState.w, command, _BV(FT_BIT_DIR_W)),
         );
 
         any_dirChange = false;
       }
-      else { // ...no direction change.
-        CBI(stepperCmdBuff_ApplyDir[dir_index], dir_bit);
-      }
 
-      if (stepperCmdBuff_produceIdx == (FTM_STEPPERCMD_BUFF_SIZE) - 1)
-        stepperCmdBuff_produceIdx = 0;
-      else
-        stepperCmdBuff_produceIdx++;
+      #if ENABLED(FTM_COMPACT_BUFFERS)
+        stepperCmdBuff[stepperCmdBuff_produceIdx] = nextStepTicks
+                                                  | (ft_packed_cmd_t(command) << (FT_PACKED_CMD_SHIFT))
+                                                  | (applyDir ? _BV32(FT_PACKED_BIT_APPLY_DIR) : 0);
+      #else
+        stepperCmdBuff[stepperCmdBuff_produceIdx] = command;
+        stepperCmdBuff_StepRelativeTi[stepperCmdBuff_produceIdx] = nextStepTicks;
+
+        const uint8_t dir_index = stepperCmdBuff_produceIdx >> 3,
+                      dir_bit = stepperCmdBuff_produceIdx & 0x7;
+        if (applyDir)
+          SBI(stepperCmdBuff_ApplyDir[dir_index], dir_bit);
+        else
+          CBI(stepperCmdBuff_ApplyDir[dir_index], dir_bit);
+      #endif
+
+      next_cmd();
 
       nextStepTicks = FTM_MIN_TICKS;
     }
   } // FTM_STEPS_PER_UNIT_TIME loop
 }
 
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  /**
+   * Check the unshaped trajectory of a test block against the trapezoid formulas,
+   * then time point generation with ZVD shaping and interpolation to stepper commands.
+   */
+  void FxdTiCtrl::test_kernels() {
+    const ft_config_t old_cfg = cfg;
+
+    // Diagonal move with extrusion that accelerates, coasts and decelerates
+    block_t blk;
+    memset((void*)&blk, 0, sizeof(blk));
+    blk.steps.x = 8000;
+    TERN_(HAS_Y_AXIS, blk.steps.y = 6000);
+    TERN_(HAS_EXTRUDERS, blk.steps.e = 500);
+    blk.direction_bits.fill();
+    blk.step_event_count = 8000;
+    blk.millimeters = SQRT(sq(blk.steps.x * planner.mm_per_step[X_AXIS]) + TERN0(HAS_Y_AXIS, sq(blk.steps.y * planner.mm_per_step[Y_AXIS])));
+    const float mm_per_event = blk.millimeters / blk.step_event_count;
+    blk.nominal_speed = 100;
+    blk.acceleration = 3000;
+    blk.initial_rate = 10 / mm_per_event;
+    blk.final_rate = 5 / mm_per_event;
+
+    // Trajectory value in steps
+    auto point_steps = [](const uint8_t a, const uint32_t i) -> float {
+      return TERN(FTM_FIXED_POINT, traj.data[a][i] * (1.0f / _BV(FTM_POS_FRAC_BITS)), traj.data[a][i] * planner.settings.axis_steps_per_mm[a]);
+    };
+
+    // Accuracy without shaping or linear advance
+    cfg.mode = ftMotionMode_ENABLED;
+    TERN_(HAS_DYNAMIC_FREQ, cfg.dynFreqMode = dynFreqMode_DISABLED);
+    TERN_(HAS_EXTRUDERS, cfg.linearAdvEna = false);
+    reset();
+    loadBlockData(&blk);
+    float max_err = 0;
+    uint32_t points = 0;
+    while (!blockProcDn) {
+      const uint32_t n = makeVector_idx, i = makeVector_batchIdx;
+      makeVector();
+      batchRdy = false;               // Nothing consumes the window here
+      points++;
+
+      double dist;
+      if (n < N1) {
+        const double tau = (n + 1) * double(FTM_TS);
+        dist = f_s * tau + 0.5 * accel_P * sq(tau);
+      }
+      else if (n < N1 + N2)
+        dist = s_1e + F_P * (n - N1 + 1) * double(FTM_TS);
+      else {
+        const double tau = (n - N1 - N2 + 1) * double(FTM_TS);
+        dist = s_2e + F_P * tau + 0.5 * decel_P * sq(tau);
+      }
+      LOOP_LOGICAL_AXES(a) {
+        const float expect = float(blk.steps[a] * dist / blk.millimeters);
+        NOLESS(max_err, ABS(point_steps(a, i) - expect));
+      }
+    }
+    SERIAL_ECHOLN(F("FT Motion trajectory: "), points, F(" points, max error "), p_float_t(max_err, 4),
+                  F(" steps "), max_err < 0.1f ? F("PASS") : F("FAIL"));
+
+    #if HAS_X_AXIS
+      // Point generation with ZVD shaping
+      cfg.mode = ftMotionMode_ZVD;
+      refreshShapingN();
+      updateShapingA();
+      reset();
+      loadBlockData(&blk);
+      points = 0;
+      uint32_t start_us = micros();
+      while (!blockProcDn) {
+        makeVector();
+        batchRdy = false;
+        points++;
+      }
+      const uint32_t shaped_us = _MAX(micros() - start_us, 1UL);
+
+      // Interpolation to stepper commands. The stepper ISR only reads the buffer in FT mode.
+      cfg.mode = ftMotionMode_DISABLED;
+      #if DISABLED(FTM_COMPACT_BUFFERS)
+        LOOP_LOGICAL_AXES(a) memcpy(trajMod.data[a], &traj.data[a][FTM_BATCH_SIZE], sizeof(trajMod.data[a]));
+      #endif
+      constexpr uint8_t reps = 10;
+      start_us = micros();
+      for (uint8_t r = 0; r < reps; ++r)
+        for (uint32_t i = 0; i < (FTM_BATCH_SIZE); ++i) convertToSteps(i);
+      const uint32_t steps_us = _MAX(micros() - start_us, 1UL);
+
+      SERIAL_ECHOLN(F("FT Motion kernels: "), uint32_t(points * 1000000ULL / shaped_us), F(" shaped points/s, "),
+                    uint32_t(reps * (FTM_BATCH_SIZE) * 1000000ULL / steps_us), F(" interpolated points/s (need "), FTM_FS, ')');
+    #endif
+
+    cfg = old_cfg;
+    #if HAS_X_AXIS
+      refreshShapingN();
+      updateShapingA();
+    #endif
+    reset();
+  }
+
+#endif // MARLIN_TEST_BUILD
+
 #endif // FT_MOTION
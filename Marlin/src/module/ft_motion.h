@@ -92,14 +92,27 @@ class FxdTiCtrl {
       reset();
     }
 
-    static ft_command_t stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE];               // Buffer of stepper commands.
-    static hal_timer_t stepperCmdBuff_StepRelativeTi[FTM_STEPPERCMD_BUFF_SIZE]; // Buffer of the stepper command timing.
-    static uint8_t stepperCmdBuff_ApplyDir[FTM_STEPPERCMD_DIR_SIZE];            // Buffer of whether DIR needs to be updated.
+    #if ENABLED(FTM_COMPACT_BUFFERS)
+      static ft_packed_cmd_t stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE];            // Buffer of packed stepper commands.
+    #else
+      static ft_command_t stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE];               // Buffer of stepper commands.
+      static hal_timer_t stepperCmdBuff_StepRelativeTi[FTM_STEPPERCMD_BUFF_SIZE]; // Buffer of the stepper command timing.
+      static uint8_t stepperCmdBuff_ApplyDir[FTM_STEPPERCMD_DIR_SIZE];            // Buffer of whether DIR needs to be updated.
+    #endif
     static uint32_t stepperCmdBuff_produceIdx,              // Index of next stepper command write to the buffer.
                     stepperCmdBuff_consumeIdx;              // Index of next stepper command read from the buffer.
 
     static bool sts_stepperBusy;                            // The stepper buffer has items and is in use.
 
+    // RAM used by the trajectory window and stepper command buffers, without and with FTM_COMPACT_BUFFERS
+    static constexpr uint32_t loose_buffer_bytes = (LOGICAL_AXES) * ((FTM_WINDOW_SIZE) + (FTM_BATCH_SIZE)) * sizeof(ft_pos_t)
+                                                 + (FTM_STEPPERCMD_BUFF_SIZE) * (sizeof(ft_command_t) + sizeof(hal_timer_t))
+                                                 + (FTM_STEPPERCMD_DIR_SIZE),
+                              buffer_bytes = TERN(FTM_COMPACT_BUFFERS,
+                                (LOGICAL_AXES) * (FTM_WINDOW_SIZE) * sizeof(ft_pos_t) + (FTM_STEPPERCMD_BUFF_SIZE) * sizeof(ft_packed_cmd_t),
+                                loose_buffer_bytes
+                              );
+
 
     // Public methods
     static void init();
@@ -124,10 +137,16 @@ class FxdTiCtrl {
 
     static void reset();                                    // Resets all states of the fixed time conversion to defaults.
 
+    #if ENABLED(MARLIN_TEST_BUILD)
+      static void test_kernels();                           // Check trajectory accuracy and report points/s.
+    #endif
+
   private:
 
     static xyze_trajectory_t traj;
-    static xyze_trajectoryMod_t trajMod;
+    #if DISABLED(FTM_COMPACT_BUFFERS)
+      static xyze_trajectoryMod_t trajMod;
+    #endif
 
     static block_t *current_block_cpy;
     static bool blockProcRdy, blockProcRdy_z1, blockProcDn;
@@ -148,6 +167,24 @@ class FxdTiCtrl {
     static uint32_t N1, N2, N3;
     static uint32_t max_intervals;
 
+    #if ENABLED(FTM_FIXED_POINT)
+      // Each trapezoid phase is a quadratic in time, so its points are made by
+      // forward differencing in steps with 32 fractional bits. That is two adds
+      // per axis per point, done for all axes together.
+      static xyze_long_t endSteps_prevBlock;      // (steps) End position of previous block
+      static xyze_float_t ratio_steps;            // (steps/mm) Axis steps per mm along the block
+      static int64_t fxp_start[LOGICAL_AXES],     // (steps << 32) Start position of block
+                     fxp_pos[LOGICAL_AXES],       // (steps << 32) Position of the next point
+                     fxp_vel[LOGICAL_AXES],       // (steps << 32) Change to the point after that
+                     fxp_acc[LOGICAL_AXES];       // (steps << 32) Change of fxp_vel per point
+      #if HAS_EXTRUDERS
+        static int64_t fxp_e_raw_z1,              // (steps << 32) Unit delay of raw extruder position
+                       fxp_e_advanced_z1,         // (steps << 32) Unit delay of advanced extruder position
+                       fxp_la_adj;                // (steps << 32) Linear advance added per point
+      #endif
+      static void startPhase();
+    #endif
+
     // Make vector variables.
     static uint32_t makeVector_idx,
                     makeVector_idx_z1,
@@ -165,9 +202,12 @@ class FxdTiCtrl {
     #if HAS_X_AXIS
 
       typedef struct AxisShaping {
-        float d_zi[FTM_ZMAX] = { 0.0f };  // Data point delay vector.
+        ft_pos_t d_zi[FTM_ZMAX] = { 0 };  // Data point delay vector.
         float Ai[5];                      // Shaping gain vector.
         uint32_t Ni[5];                   // Shaping time index vector.
+        #if ENABLED(FTM_FIXED_POINT)
+          int32_t Ai_q[5];                // Shaping gains with 30 fractional bits.
+        #endif
 
         void updateShapingN(const_float_t f, const_float_t df);
 
@@ -48,8 +48,15 @@ enum stepDirState_t : uint8_t {
   stepDirState_NEG     = 2U
 };
 
-typedef struct XYZEarray<float, FTM_WINDOW_SIZE> xyze_trajectory_t;
-typedef struct XYZEarray<float, FTM_BATCH_SIZE> xyze_trajectoryMod_t;
+#if ENABLED(FTM_FIXED_POINT)
+  #define FTM_POS_FRAC_BITS 4   // Fractional bits of fixed-point trajectory positions
+  typedef int32_t ft_pos_t;     // (steps << FTM_POS_FRAC_BITS) Trajectory point
+#else
+  typedef float ft_pos_t;       // (mm) Trajectory point
+#endif
+
+typedef struct XYZEarray<ft_pos_t, FTM_WINDOW_SIZE> xyze_trajectory_t;
+typedef struct XYZEarray<ft_pos_t, FTM_BATCH_SIZE> xyze_trajectoryMod_t;
 
 typedef struct XYZEval<stepDirState_t> xyze_stepDir_t;
 
@@ -70,3 +77,12 @@ enum {
 };
 
 typedef bits_t(FT_BIT_COUNT) ft_command_t;
+
+#if ENABLED(FTM_COMPACT_BUFFERS)
+  // A packed command has the ticks since the previous command in the low 16 bits,
+  // the step/dir bits above them, and a flag in the top bit to apply DIR.
+  typedef uint32_t ft_packed_cmd_t;
+  #define FT_PACKED_TICKS_MAX 0xFFFFU
+  #define FT_PACKED_CMD_SHIFT 16
+  #define FT_PACKED_BIT_APPLY_DIR 31
+#endif
@@ -1368,6 +1368,72 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
 
   #endif // SEGMENT_LEVELED_MOVES && !AUTO_BED_LEVELING_UBL
 
+  #if HAS_LEVELED_CELL_SEGMENTS
+
+    /**
+     * Prepare a mesh-leveled move on a CARTESIAN setup,
+     * splitting it only where it crosses mesh cell edges.
+     *
+     * Grid lines are visited in order along the move, so
+     * there's no recursion and no limit on the cells crossed.
+     */
+    inline void cell_line_to_destination(const_feedRate_t fr_mm_s) {
+
+      // Get the start and end cells for this move
+      const xy_uint8_t c1 = bedlevel.cell_indexes(current_position),
+                       c2 = bedlevel.cell_indexes(destination);
+
+      // Start and end in the same cell? No split needed.
+      if (c1 == c2) {
+        planner.buffer_line(destination, fr_mm_s);
+        return;
+      }
+
+      const xyze_float_t diff = destination - current_position;
+
+      // Get the linear distance in XYZ
+      #if HAS_ROTATIONAL_AXES
+        bool cartes_move = true;
+      #endif
+      const float cartesian_mm = get_move_distance(diff OPTARG(HAS_ROTATIONAL_AXES, cartes_move));
+
+      // Add hints to help optimize the move
+      PlannerHints hints;
+      TERN_(HAS_ROTATIONAL_AXES, hints.cartesian_move = cartes_move);
+
+      // Grid lines left to cross, the next one on each axis, and the fraction of the move to reach it
+      const int8_t sx = c2.x > c1.x ? 1 : -1, sy = c2.y > c1.y ? 1 : -1;
+      uint8_t xleft = ABS(int8_t(c2.x - c1.x)), yleft = ABS(int8_t(c2.y - c1.y)),
+              gx = c1.x + (sx > 0), gy = c1.y + (sy > 0);
+
+      #define CELL_EDGE_FRACTION(A) (A##left ? (bedlevel.get_cell_edge_##A(g##A) - current_position.A) / diff.A : 2.0f)
+      float tx = CELL_EDGE_FRACTION(x), ty = CELL_EDGE_FRACTION(y), tprev = 0;
+
+      millis_t next_idle_ms = millis() + 200UL;
+      while (xleft || yleft) {
+        segment_idle(next_idle_ms);
+
+        // Split at the nearest grid line. Crossing at a grid point splits once.
+        const float t = _MIN(tx, ty);
+        if (tx <= t) { if (--xleft) gx += sx; tx = CELL_EDGE_FRACTION(x); }
+        if (ty <= t) { if (--yleft) gy += sy; ty = CELL_EDGE_FRACTION(y); }
+
+        // Skip degenerate splits from rounding
+        if (t <= tprev || t >= 1.0f) continue;
+
+        hints.millimeters = cartesian_mm * (t - tprev);
+        tprev = t;
+        if (!planner.buffer_line(current_position + diff * t, fr_mm_s, active_extruder, hints))
+          break;
+      }
+
+      // The final move must be to the exact destination.
+      hints.millimeters = cartesian_mm * (1.0f - tprev);
+      planner.buffer_line(destination, fr_mm_s, active_extruder, hints);
+    }
+
+  #endif // HAS_LEVELED_CELL_SEGMENTS
+
   /**
    * Prepare a linear move in a Cartesian setup.
    *
@@ -1387,6 +1453,9 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
             bedlevel.line_to_destination_cartesian(scaled_fr_mm_s, active_extruder); // UBL's motion routine needs to know about
             return true;                                                             // all moves, including Z-only moves.
           #endif
+        #elif HAS_LEVELED_CELL_SEGMENTS
+          cell_line_to_destination(scaled_fr_mm_s);
+          return false; // caller will update current_position
         #elif ENABLED(SEGMENT_LEVELED_MOVES)
           segmented_line_to_destination(scaled_fr_mm_s);
           return false; // caller will update current_position
@@ -136,6 +136,10 @@ volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // Delay block delivery so initial blocks in an empty queue may merge
 
+#if HAS_PLANNER_STATS
+  Planner::kernel_stats_t Planner::kernel_stats;
+#endif
+
 planner_settings_t Planner::settings;           // Initialized by settings.load()
 
 /**
@@ -779,6 +783,193 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
+#if DISABLED(PLANNER_FIXED_POINT) || ENABLED(MARLIN_TEST_BUILD)
+
+  /**
+   * Get the trapezoid shape of a block using float math
+   */
+  void Planner::calc_trapezoid_float(trapezoid_t &trap, const uint32_t step_event_count, const uint32_t nominal_rate, const uint32_t initial_rate, const uint32_t final_rate, const uint32_t accel) {
+
+    // If we have some plateau time, the cruise rate will be the nominal rate
+    trap.cruise_rate = nominal_rate;
+
+    // Steps for acceleration, plateau and deceleration
+    int32_t plateau_steps = step_event_count;
+    trap.accelerate_steps = trap.decelerate_steps = 0;
+
+    float inverse_accel = 0.0f;
+    if (accel != 0) {
+      inverse_accel = 1.0f / accel;
+      const float half_inverse_accel = 0.5f * inverse_accel,
+                  nominal_rate_sq = sq(float(nominal_rate)),
+                  // Steps required for acceleration, deceleration to/from nominal rate
+                  decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate)));
+            float accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
+      trap.accelerate_steps = CEIL(accelerate_steps_float);
+      trap.decelerate_steps = FLOOR(decelerate_steps_float);
+
+      // Steps between acceleration and deceleration, if any
+      plateau_steps -= trap.accelerate_steps + trap.decelerate_steps;
+
+      // Does accelerate_steps + decelerate_steps exceed step_event_count?
+      // Then we can't possibly reach the nominal rate, there will be no cruising.
+      // Calculate accel / braking time in order to reach the final_rate exactly
+      // at the end of this block.
+      if (plateau_steps < 0) {
+        accelerate_steps_float = CEIL((step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
+        trap.accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), step_event_count);
+        trap.decelerate_steps = step_event_count - trap.accelerate_steps;
+
+        #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+          // We won't reach the cruising rate. Let's calculate the speed we will reach
+          trap.cruise_rate = final_speed(initial_rate, accel, trap.accelerate_steps);
+        #endif
+      }
+    }
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
+      // Jerk controlled speed requires to express speed versus time, NOT steps
+      trap.acceleration_time = rate_factor * float(trap.cruise_rate - initial_rate);
+      trap.deceleration_time = rate_factor * float(trap.cruise_rate - final_rate);
+    #endif
+  }
+
+#endif
+
+#if ANY(PLANNER_FIXED_POINT, MARLIN_TEST_BUILD)
+
+  #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+    // Integer square root, rounded down
+    static uint32_t isqrt64(uint64_t n) {
+      uint64_t root = 0, bit = uint64_t(1) << 62;
+      while (bit > n) bit >>= 2;
+      for (; bit; bit >>= 2) {
+        if (n >= root + bit) { n -= root + bit; root = (root >> 1) + bit; }
+        else root >>= 1;
+      }
+      return uint32_t(root);
+    }
+  #endif
+
+  /**
+   * Get the trapezoid shape of a block using integer math.
+   *
+   * Steps come from rate^2 differences held exactly in 64 bits, so there is no
+   * float division. Results match calc_trapezoid_float within 1 step or step/s.
+   */
+  void Planner::calc_trapezoid_fixed(trapezoid_t &trap, const uint32_t step_event_count, const uint32_t nominal_rate, const uint32_t initial_rate, const uint32_t final_rate, const uint32_t accel) {
+
+    // If we have some plateau time, the cruise rate will be the nominal rate
+    trap.cruise_rate = nominal_rate;
+    trap.accelerate_steps = trap.decelerate_steps = 0;
+
+    if (accel != 0) {
+      const uint64_t accel_x2 = uint64_t(accel) << 1;
+      const int64_t nominal_rate_sq = sq(uint64_t(nominal_rate)),
+                    initial_rate_sq = sq(uint64_t(initial_rate)),
+                    final_rate_sq = sq(uint64_t(final_rate)),
+                    // rate^2 differences for acceleration, deceleration to/from nominal rate
+                    accelerate_sq = nominal_rate_sq - initial_rate_sq,
+                    decelerate_sq = nominal_rate_sq - final_rate_sq;
+
+      // Steps required for acceleration (rounded up) and deceleration (rounded down)
+      const uint64_t accelerate_steps = accelerate_sq > 0 ? (uint64_t(accelerate_sq) + accel_x2 - 1) / accel_x2 : 0,
+                     decelerate_steps = decelerate_sq > 0 ? uint64_t(decelerate_sq) / accel_x2 : 0;
+
+      if (accelerate_steps + decelerate_steps <= step_event_count) {
+        trap.accelerate_steps = accelerate_steps;
+        trap.decelerate_steps = decelerate_steps;
+      }
+      else {
+        // No cruising. Accelerate up to the point where braking reaches final_rate exactly at the end:
+        // ceil((step_event_count + (final_rate^2 - initial_rate^2) / 2a) / 2)
+        const int64_t meet_sq = int64_t(step_event_count) * accel_x2 + final_rate_sq - initial_rate_sq;
+        trap.accelerate_steps = meet_sq > 0 ? _MIN((uint64_t(meet_sq) + (accel_x2 << 1) - 1) / (accel_x2 << 1), uint64_t(step_event_count)) : 0;
+        trap.decelerate_steps = step_event_count - trap.accelerate_steps;
+
+        #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+          // We won't reach the cruising rate. Let's calculate the speed we will reach
+          trap.cruise_rate = isqrt64(initial_rate_sq + accel_x2 * trap.accelerate_steps);
+        #endif
+      }
+    }
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // Jerk controlled speed requires to express speed versus time, NOT steps
+      trap.acceleration_time = accel ? uint64_t(STEPPER_TIMER_RATE) * uint32_t(trap.cruise_rate - initial_rate) / accel : 0;
+      trap.deceleration_time = accel ? uint64_t(STEPPER_TIMER_RATE) * uint32_t(trap.cruise_rate - final_rate) / accel : 0;
+    #endif
+  }
+
+#endif
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  /**
+   * Compare the integer and float trapezoid math over pseudo-random blocks,
+   * then report the blocks per second each can shape.
+   */
+  void Planner::test_trapezoid() {
+    constexpr uint16_t test_blocks = 2000;
+    uint32_t seed = 1;
+    auto rnd = [&](const uint32_t lo, const uint32_t hi) { seed = seed * 1664525UL + 1013904223UL; return lo + (seed >> 8) % (hi - lo + 1); };
+    auto near = [](const uint32_t a, const uint32_t b, const uint32_t tol) { return (a > b ? a - b : b - a) <= tol; };
+
+    struct { uint32_t step_event_count, nominal_rate, initial_rate, final_rate, accel; } blocks[32];
+    auto random_block = [&](const uint8_t i) {
+      blocks[i].step_event_count = rnd(1, 20000);
+      blocks[i].nominal_rate = rnd(MINIMAL_STEP_RATE, 60000);
+      blocks[i].initial_rate = rnd(MINIMAL_STEP_RATE, blocks[i].nominal_rate);
+      blocks[i].final_rate = rnd(MINIMAL_STEP_RATE, blocks[i].nominal_rate);
+      blocks[i].accel = rnd(100, 400000);
+    };
+
+    uint16_t fails = 0;
+    for (uint16_t n = 0; n < test_blocks; ++n) {
+      random_block(0);
+      const auto &b = blocks[0];
+      trapezoid_t tf, tx;
+      calc_trapezoid_float(tf, b.step_event_count, b.nominal_rate, b.initial_rate, b.final_rate, b.accel);
+      calc_trapezoid_fixed(tx, b.step_event_count, b.nominal_rate, b.initial_rate, b.final_rate, b.accel);
+
+      // A step more or less of acceleration moves the reached rate by up to accel / rate
+      const uint32_t rate_tol = 1 + b.accel / tx.cruise_rate;
+      bool ok = near(tf.accelerate_steps, tx.accelerate_steps, 1)
+             && near(tf.decelerate_steps, tx.decelerate_steps, 1)
+             && near(tf.cruise_rate, tx.cruise_rate, rate_tol);
+      #if ENABLED(S_CURVE_ACCELERATION)
+        // Times are only meaningful when the reached rate isn't below the exit rate
+        if (ok && _MIN(tf.cruise_rate, tx.cruise_rate) >= b.final_rate) {
+          const uint32_t time_tol = 1 + uint64_t(STEPPER_TIMER_RATE) * rate_tol / b.accel + (tf.acceleration_time >> 20) + (tf.deceleration_time >> 20);
+          ok = near(tf.acceleration_time, tx.acceleration_time, time_tol) && near(tf.deceleration_time, tx.deceleration_time, time_tol);
+        }
+      #endif
+      if (!ok) {
+        if (!fails) SERIAL_ECHOLNPGM("Trapezoid mismatch steps=", b.step_event_count, " nominal=", b.nominal_rate, " initial=", b.initial_rate, " final=", b.final_rate, " accel=", b.accel);
+        ++fails;
+      }
+    }
+    SERIAL_ECHOLNPGM("Trapezoid fixed vs float: ", test_blocks - fails, "/", test_blocks, fails ? " FAIL" : " PASS");
+
+    // Blocks shaped per second by each path
+    for (uint8_t i = 0; i < COUNT(blocks); ++i) random_block(i);
+    auto bench = [&](FSTR_P const name, void (*calc)(trapezoid_t&, const uint32_t, const uint32_t, const uint32_t, const uint32_t, const uint32_t)) {
+      trapezoid_t t;
+      const uint32_t start_us = micros();
+      for (uint16_t n = 0; n < test_blocks; ++n) {
+        const auto &b = blocks[n % COUNT(blocks)];
+        calc(t, b.step_event_count, b.nominal_rate, b.initial_rate, b.final_rate, b.accel);
+      }
+      const uint32_t us = _MAX(micros() - start_us, 1UL);
+      SERIAL_ECHOLN(F("Trapezoid "), name, F(": "), uint32_t(test_blocks * 1000000ULL / us), F(" blocks/s"));
+    };
+    bench(F("float"), calc_trapezoid_float);
+    bench(F("fixed"), calc_trapezoid_fixed);
+  }
+
+#endif // MARLIN_TEST_BUILD
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
@@ -798,55 +989,21 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
   NOLESS(final_rate, uint32_t(MINIMAL_STEP_RATE));
 
+  // Steps for acceleration and deceleration, and the rate reached
+  trapezoid_t trap;
+  TERN(PLANNER_FIXED_POINT, calc_trapezoid_fixed, calc_trapezoid_float)(trap, block->step_event_count, block->nominal_rate, initial_rate, final_rate, block->acceleration_steps_per_s2);
+
   #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
-    // If we have some plateau time, the cruise rate will be the nominal rate
-    uint32_t cruise_rate = block->nominal_rate;
+    const uint32_t cruise_rate = trap.cruise_rate;
   #endif
-
-  // Steps for acceleration, plateau and deceleration
-  int32_t plateau_steps = block->step_event_count;
-  uint32_t accelerate_steps = 0,
-           decelerate_steps = 0;
-
-  const int32_t accel = block->acceleration_steps_per_s2;
-  float inverse_accel = 0.0f;
-  if (accel != 0) {
-    inverse_accel = 1.0f / accel;
-    const float half_inverse_accel = 0.5f * inverse_accel,
-                nominal_rate_sq = sq(float(block->nominal_rate)),
-                // Steps required for acceleration, deceleration to/from nominal rate
-                decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate)));
-          float accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
-    accelerate_steps = CEIL(accelerate_steps_float);
-    decelerate_steps = FLOOR(decelerate_steps_float);
-
-    // Steps between acceleration and deceleration, if any
-    plateau_steps -= accelerate_steps + decelerate_steps;
-
-    // Does accelerate_steps + decelerate_steps exceed step_event_count?
-    // Then we can't possibly reach the nominal rate, there will be no cruising.
-    // Calculate accel / braking time in order to reach the final_rate exactly
-    // at the end of this block.
-    if (plateau_steps < 0) {
-      accelerate_steps_float = CEIL((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
-      accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
-      decelerate_steps = block->step_event_count - accelerate_steps;
-
-      #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
-        // We won't reach the cruising rate. Let's calculate the speed we will reach
-        cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
-      #endif
-    }
-  }
+  const uint32_t accelerate_steps = trap.accelerate_steps, decelerate_steps = trap.decelerate_steps;
 
   #if ENABLED(S_CURVE_ACCELERATION)
-    const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
-    // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = rate_factor * float(cruise_rate - initial_rate),
-             deceleration_time = rate_factor * float(cruise_rate - final_rate),
+    const uint32_t acceleration_time = trap.acceleration_time,
+                   deceleration_time = trap.deceleration_time,
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
-             acceleration_time_inverse = get_period_inverse(acceleration_time),
-             deceleration_time_inverse = get_period_inverse(deceleration_time);
+                   acceleration_time_inverse = get_period_inverse(acceleration_time),
+                   deceleration_time_inverse = get_period_inverse(deceleration_time);
   #endif
 
   // Store new block parameters
@@ -992,9 +1149,11 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
  */
 
 // The kernel called by recalculate() when scanning the plan from last to first entry.
-void Planner::reverse_pass_kernel(block_t * const current, const block_t * const next
+// Return 'true' if the entry speed of the current block was changed.
+bool Planner::reverse_pass_kernel(block_t * const current, const block_t * const next
   OPTARG(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)
 ) {
+  TERN_(HAS_PLANNER_STATS, ++kernel_stats.reverse_calls);
   if (current) {
     // If entry speed is already at the maximum entry speed, and there was no change of speed
     // in the next block, there is no need to recheck. Block is cruising and there is no need to
@@ -1017,7 +1176,7 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
       const float next_entry_speed_sqr = next ? next->entry_speed_sqr : _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr), sq(float(MINIMUM_PLANNER_SPEED))),
                   new_entry_speed_sqr = current->flag.nominal_length
                     ? max_entry_speed_sqr
-                    : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current->acceleration, next_entry_speed_sqr, current->millimeters));
+                    : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(current, next_entry_speed_sqr));
       if (current->entry_speed_sqr != new_entry_speed_sqr) {
 
         // Need to recalculate the block speed - Mark it now, so the stepper
@@ -1036,17 +1195,22 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
           // Block is not BUSY so this is ahead of the Stepper ISR:
           // Just Set the new entry speed.
           current->entry_speed_sqr = new_entry_speed_sqr;
+          return true;
         }
       }
     }
   }
+  return false;
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass.
+ *
+ * Return the index of the block where the plan is known to be unchanged,
+ * or the planned block index if the pass went all the way back.
  */
-void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
+uint8_t Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // Initialize block index to the last block in the planner buffer.
   uint8_t block_index = prev_block_index(block_buffer_head);
 
@@ -1057,7 +1221,7 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
   // If there was a race condition and block_buffer_planned was incremented
   //  or was pointing at the head (queue empty) break loop now and avoid
   //  planning already consumed blocks
-  if (planned_block_index == block_buffer_head) return;
+  if (planned_block_index == block_buffer_head) return planned_block_index;
 
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
@@ -1070,7 +1234,13 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
 
     // Only process movement blocks
     if (current->is_move()) {
-      reverse_pass_kernel(current, next OPTARG(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
+      // The blocks before an unchanged entry speed were planned against that same speed,
+      // so the rest of the pass can't change anything. This is the stable prefix of the plan.
+      // The newest block is exempt since the block before it was planned to stop, not to join it.
+      if (!reverse_pass_kernel(current, next OPTARG(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr)) && next) {
+        TERN_(HAS_PLANNER_STATS, ++kernel_stats.reverse_stops);
+        return block_index;
+      }
       next = current;
     }
 
@@ -1083,16 +1253,18 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
     while (planned_block_index != block_buffer_planned) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == planned_block_index) return;
+      if (block_index == planned_block_index) return planned_block_index;
 
       // Advance the pointer, following the busy block
       planned_block_index = next_block_index(planned_block_index);
     }
   }
+  return planned_block_index;
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
 void Planner::forward_pass_kernel(const block_t * const previous, block_t * const current, const uint8_t block_index) {
+  TERN_(HAS_PLANNER_STATS, ++kernel_stats.forward_calls);
   if (previous) {
     // If the previous block is an acceleration block, too short to complete the full speed
     // change, adjust the entry speed accordingly. Entry speeds have already been reset,
@@ -1101,7 +1273,7 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
     if (!previous->flag.nominal_length && previous->entry_speed_sqr < current->entry_speed_sqr) {
 
       // Compute the maximum allowable speed
-      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous->acceleration, previous->entry_speed_sqr, previous->millimeters);
+      const float new_entry_speed_sqr = max_allowable_speed_sqr(previous, previous->entry_speed_sqr);
 
       // If true, current block is full-acceleration and we can move the planned pointer forward.
       if (new_entry_speed_sqr < current->entry_speed_sqr) {
@@ -1130,21 +1302,24 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
         }
       }
     }
-
-    // Any block set at its maximum entry speed also creates an optimal plan up to this
-    // point in the buffer. When the plan is bracketed by either the beginning of the
-    // buffer and a maximum entry speed or two maximum entry speeds, every block in between
-    // cannot logically be further improved. Hence, we don't have to recompute them anymore.
-    if (current->entry_speed_sqr == current->max_entry_speed_sqr)
-      block_buffer_planned = block_index;
   }
+
+  // Any block set at its maximum entry speed also creates an optimal plan up to this
+  // point in the buffer. When the plan is bracketed by either the beginning of the
+  // buffer and a maximum entry speed or two maximum entry speeds, every block in between
+  // cannot logically be further improved. Hence, we don't have to recompute them anymore.
+  // This includes the first block of the pass, which may start past the planned pointer.
+  if (current->entry_speed_sqr == current->max_entry_speed_sqr)
+    block_buffer_planned = block_index;
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the forward pass.
+ *
+ * Blocks before 'stable_index' were left unchanged by the reverse pass, so start there.
  */
-void Planner::forward_pass() {
+void Planner::forward_pass(const uint8_t stable_index) {
 
   // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
@@ -1155,6 +1330,10 @@ void Planner::forward_pass() {
   //  pass will never modify the values at the tail.
   uint8_t block_index = block_buffer_planned;
 
+  // Skip ahead to the stable block, unless the ISR has already gone past it
+  if (BLOCK_MOD(block_buffer_head - stable_index) < BLOCK_MOD(block_buffer_head - block_index))
+    block_index = stable_index;
+
   block_t *block;
   const block_t * previous = nullptr;
   while (block_index != block_buffer_head) {
@@ -1278,13 +1457,27 @@ void Planner::recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_s
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
-  if (block_index != block_buffer_planned) {
-    reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
-    forward_pass();
-  }
+  TERN_(HAS_PLANNER_STATS, ++kernel_stats.blocks);
+  if (block_index != block_buffer_planned)
+    forward_pass(reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr)));
   recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
 }
 
+#if HAS_PLANNER_STATS
+
+  void Planner::report_kernel_stats(const bool reset/*=true*/) {
+    const uint32_t blocks = _MAX(kernel_stats.blocks, 1UL);
+    SERIAL_ECHOLNPGM(
+      "Planner blocks:", kernel_stats.blocks,
+      " reverse:", kernel_stats.reverse_calls, " (", p_float_t(float(kernel_stats.reverse_calls) / blocks, 2),
+      "/block) forward:", kernel_stats.forward_calls, " (", p_float_t(float(kernel_stats.forward_calls) / blocks, 2),
+      "/block) stable stops:", kernel_stats.reverse_stops
+    );
+    if (reset) kernel_stats = {};
+  }
+
+#endif
+
 /**
  * Apply fan speeds
  */
@@ -2070,6 +2263,33 @@ bool Planner::_populate_block(
     , ABS(dist.i), ABS(dist.j), ABS(dist.k), ABS(dist.u), ABS(dist.v), ABS(dist.w)
   ));
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    /**
+     * An arc block has the same start and end as a line, but the plane axes follow the arc.
+     * Give the plane axes an upper bound on their steps along the whole arc, so that the
+     * acceleration limits and axis enables below account for every part of the arc.
+     */
+    const bool is_arc = hints.arc.chords;
+    const AxisEnum arc_p = hints.arc.axis_p, arc_q = hints.arc.axis_q;
+    float arc_radius, arc_plane_mm;
+    xy_float_t arc_tan_in, arc_tan_out;         // Unit tangents at the start and end of the arc
+    if (is_arc) {
+      const block_arc_t &arc = hints.arc;
+      arc_radius = arc.rvec.magnitude();
+      arc_plane_mm = arc.chords * arc_radius * ABS(arc.sin_T) * RSQRT(0.5f * (1.0f + arc.cos_T)); // Length of all chords
+      block->flag.arc = true;
+      block->arc = arc;
+      block->arc.delta.set(dist[arc_p], dist[arc_q]);
+      block->steps[arc_p] = CEIL(arc_plane_mm * settings.axis_steps_per_mm[arc_p]) + arc.chords;
+      block->steps[arc_q] = CEIL(arc_plane_mm * settings.axis_steps_per_mm[arc_q]) + arc.chords;
+
+      const float inv_r = (arc.sin_T < 0 ? -1.0f : 1.0f) / arc_radius;
+      const xy_float_t r_end = { arc.rvec.x + dist[arc_p] * mm_per_step[arc_p], arc.rvec.y + dist[arc_q] * mm_per_step[arc_q] };
+      arc_tan_in.set(-arc.rvec.y * inv_r, arc.rvec.x * inv_r);
+      arc_tan_out.set(-r_end.y * inv_r, r_end.x * inv_r);
+    }
+  #endif
+
   /**
    * This part of the code calculates the total length of the movement.
    * For cartesian bots, the X_AXIS is the real X movement and same for Y_AXIS.
@@ -2192,6 +2412,19 @@ bool Planner::_populate_block(
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    if (is_arc) {
+      // Give every chord the same number of step events, enough for its own plane steps
+      // and for its share of the steps on the other axes
+      const uint16_t chords = block->arc.chords;
+      const uint32_t chord_events = _MAX(
+        uint32_t(CEIL(arc_plane_mm / chords * _MAX(settings.axis_steps_per_mm[arc_p], settings.axis_steps_per_mm[arc_q]))) + 1,
+        (block->step_event_count + chords - 1) / chords
+      );
+      block->step_event_count = chords * chord_events;
+    }
+  #endif
+
   TERN_(MIXING_EXTRUDER, mixer.populate_block(block->b_color));
 
   #if HAS_FAN
@@ -2366,6 +2599,20 @@ bool Planner::_populate_block(
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
   }
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    if (is_arc) {
+      // Each plane axis reaches the full plane speed somewhere on the arc, so apply the
+      // lower feedrate limit of the two, and keep the centripetal acceleration v^2/r in bounds.
+      const float v_plane = arc_plane_mm * inverse_secs,
+                  max_fr = _MIN(settings.max_feedrate_mm_s[arc_p], settings.max_feedrate_mm_s[arc_q]),
+                  max_v_sqr = _MIN(settings.max_acceleration_mm_per_s2[arc_p], settings.max_acceleration_mm_per_s2[arc_q]) * arc_radius;
+      current_speed[arc_p] = arc_tan_in.x * v_plane;
+      current_speed[arc_q] = arc_tan_in.y * v_plane;
+      if (v_plane > max_fr) NOMORE(speed_factor, max_fr / v_plane);
+      if (sq(v_plane) > max_v_sqr) NOMORE(speed_factor, SQRT(max_v_sqr) / v_plane);
+    }
+  #endif
+
   // Limit speed on extruders, if any
   #if HAS_EXTRUDERS
     {
@@ -2493,9 +2740,10 @@ bool Planner::_populate_block(
       if (use_advance_lead) {
         float e_D_ratio = (target_float.e - position_float.e) /
           TERN(IS_KINEMATIC, block->millimeters,
-            SQRT(sq(target_float.x - position_float.x)
-               + sq(target_float.y - position_float.y)
-               + sq(target_float.z - position_float.z))
+            (TERN0(ARC_NATIVE_BLOCKS, is_arc) ? block->millimeters
+              : SQRT(sq(target_float.x - position_float.x)
+                   + sq(target_float.y - position_float.y)
+                   + sq(target_float.z - position_float.z)))
           );
 
         // Check for unusual high e_D ratio to detect if a retract move was combined with the last print move due to min. steps per segment. Never execute this with advance!
@@ -2529,9 +2777,15 @@ bool Planner::_populate_block(
         LIMIT_ACCEL_FLOAT(U_AXIS, 0), LIMIT_ACCEL_FLOAT(V_AXIS, 0), LIMIT_ACCEL_FLOAT(W_AXIS, 0)
       );
     }
+
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // The arc tangent sweeps the plane, so either plane axis may take the whole acceleration
+      if (is_arc) NOMORE(accel, uint32_t(_MIN(settings.max_acceleration_mm_per_s2[arc_p], settings.max_acceleration_mm_per_s2[arc_q]) * steps_per_mm));
+    #endif
   }
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
+  TERN_(PLANNER_FIXED_POINT, block->accel_speed_sqr = 2 * block->acceleration * block->millimeters);
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = (uint32_t)(accel * (float(1UL << 24) / (STEPPER_TIMER_RATE)));
   #endif
@@ -2606,6 +2860,14 @@ bool Planner::_populate_block(
       #endif
     ;
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // An arc meets the previous block along its entry tangent
+      if (is_arc) {
+        unit_vec[arc_p] = arc_tan_in.x * arc_plane_mm;
+        unit_vec[arc_q] = arc_tan_in.y * arc_plane_mm;
+      }
+    #endif
+
     /**
      * On CoreXY the length of the vector [A,B] is SQRT(2) times the length of the head movement vector [X,Y].
      * So taking Z and E into account, we cannot scale to a unit vector with "inverse_millimeters".
@@ -2754,6 +3016,15 @@ bool Planner::_populate_block(
 
     prev_unit_vec = unit_vec;
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // ...and meets the next block along its exit tangent
+      if (is_arc) {
+        const float plane = SQRT(sq(unit_vec[arc_p]) + sq(unit_vec[arc_q]));
+        prev_unit_vec[arc_p] = arc_tan_out.x * plane;
+        prev_unit_vec[arc_q] = arc_tan_out.y * plane;
+      }
+    #endif
+
   #endif
 
   #if HAS_CLASSIC_JERK
@@ -2857,7 +3128,7 @@ bool Planner::_populate_block(
   block->max_entry_speed_sqr = vmax_junction_sqr;
 
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
+  const float v_allowable_sqr = max_allowable_speed_sqr(block, sq(float(MINIMUM_PLANNER_SPEED)));
 
   // Start with the minimum allowed speed
   block->entry_speed_sqr = sq(float(MINIMUM_PLANNER_SPEED));
@@ -2876,6 +3147,14 @@ bool Planner::_populate_block(
   previous_speed = current_speed;
   previous_nominal_speed = block->nominal_speed;
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    if (is_arc) {
+      const float v_plane = block->nominal_speed * arc_plane_mm * inverse_millimeters;
+      previous_speed[arc_p] = arc_tan_out.x * v_plane;
+      previous_speed[arc_q] = arc_tan_out.y * v_plane;
+    }
+  #endif
+
   position = target;  // Update the position
 
   #if ENABLED(POWER_LOSS_RECOVERY)
@@ -131,6 +131,9 @@ enum BlockFlagBit {
 
   // Sync laser power from a queued block
   OPTARG(LASER_POWER_SYNC, BLOCK_BIT_LASER_PWR)
+
+  // The block is an arc traced in chords by the stepper
+  OPTARG(ARC_NATIVE_BLOCKS, BLOCK_BIT_ARC)
 };
 
 /**
@@ -160,6 +163,10 @@ typedef struct {
       #if ENABLED(LASER_POWER_SYNC)
         bool sync_laser_pwr:1;
       #endif
+
+      #if ENABLED(ARC_NATIVE_BLOCKS)
+        bool arc:1;
+      #endif
     };
   };
 
@@ -202,6 +209,23 @@ typedef struct {
 
 #endif
 
+#if ENABLED(ARC_NATIVE_BLOCKS)
+
+  /**
+   * An arc in the plane of axis_p / axis_q, traced by the stepper as 'chords'
+   * equal chords, each one rotating the radius vector by the angle (cos_T, sin_T).
+   * Other axes step along with the arc as in a linear block.
+   */
+  typedef struct {
+    float cos_T, sin_T;                     // Rotation of the radius vector per chord
+    xy_float_t rvec;                        // (mm) Vector from the center to the start of the arc
+    xy_long_t delta;                        // (steps) Net motion of the plane axes over the whole arc
+    uint16_t chords;                        // Number of chords in the arc. Zero for a linear block.
+    AxisEnum axis_p, axis_q;                // The axes of the arc plane
+  } block_arc_t;
+
+#endif
+
 /**
  * struct block_t
  *
@@ -220,6 +244,7 @@ typedef struct PlannerBlock {
   bool is_sync() { return flag.sync_position || is_fan_sync() || is_pwr_sync(); }
   bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
   bool is_move() { return !(is_sync() || is_page()); }
+  bool is_arc() { return TERN0(ARC_NATIVE_BLOCKS, flag.arc); }
 
   // Fields used by the motion planner to manage acceleration
   float nominal_speed,                      // The nominal speed for this block in (mm/sec)
@@ -228,6 +253,10 @@ typedef struct PlannerBlock {
         millimeters,                        // The total travel of this block in mm
         acceleration;                       // acceleration mm/sec^2
 
+  #if ENABLED(PLANNER_FIXED_POINT)
+    float accel_speed_sqr;                  // Change of speed^2 over the whole block: 2 * acceleration * millimeters
+  #endif
+
   union {
     abce_ulong_t steps;                     // Step count along each axis
     abce_long_t position;                   // New position to force when this sync block is executed
@@ -260,6 +289,10 @@ typedef struct PlannerBlock {
 
   AxisBits direction_bits;                  // Direction bits set for this block, where 1 is negative motion
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    block_arc_t arc;                        // Arc geometry, valid if flag.arc is set
+  #endif
+
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
     uint32_t la_advance_rate;               // The rate at which steps are added whilst accelerating
@@ -369,11 +402,22 @@ typedef struct {
   typedef uvalue_t(BLOCK_BUFFER_SIZE * 2) last_move_t;
 #endif
 
-#if ENABLED(ARC_SUPPORT)
+#if ANY(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   #define HINTS_CURVE_RADIUS
   #define HINTS_SAFE_EXIT_SPEED
 #endif
 
+/**
+ * Trapezoid shape of a block: steps spent accelerating and decelerating,
+ * the rate reached in between, and the time spent in each S-Curve ramp.
+ */
+typedef struct {
+  uint32_t accelerate_steps, decelerate_steps, cruise_rate;
+  #if ENABLED(S_CURVE_ACCELERATION)
+    uint32_t acceleration_time, deceleration_time;  // (STEP timer counts)
+  #endif
+} trapezoid_t;
+
 struct PlannerHints {
   float millimeters = 0.0;            // Move Length, if known, else 0.
   #if ENABLED(FEEDRATE_SCALING)
@@ -390,6 +434,10 @@ struct PlannerHints {
                                       // would calculate if it knew the as-yet-unbuffered path
   #endif
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    block_arc_t arc = {};             // Arc to trace within the segment, if arc.chords is non-zero
+  #endif
+
   #if HAS_ROTATIONAL_AXES
     bool cartesian_move = true;       // True if linear motion of the tool centerpoint relative to the workpiece occurs.
                                       // False if no movement of the tool center point relative to the work piece occurs
@@ -972,6 +1020,21 @@ class Planner {
     // Called from the Temperature ISR at ~1kHz
     static void isr() { if (cleaning_buffer_counter) --cleaning_buffer_counter; }
 
+    #if ENABLED(MARLIN_TEST_BUILD)
+      static void test_trapezoid();
+    #endif
+
+    #if HAS_PLANNER_STATS
+      typedef struct {
+        uint32_t blocks,          // Blocks queued (recalculations)
+                 reverse_calls,   // Reverse pass kernel runs
+                 forward_calls,   // Forward pass kernel runs
+                 reverse_stops;   // Reverse passes ended early at the stable prefix
+      } kernel_stats_t;
+      static kernel_stats_t kernel_stats;
+      static void report_kernel_stats(const bool reset=true);
+    #endif
+
     /**
      * Does the buffer have any blocks queued?
      */
@@ -1041,6 +1104,14 @@ class Planner {
       return target_velocity_sqr - 2 * accel * distance;
     }
 
+    // The same, decelerating over the whole of a block
+    static float max_allowable_speed_sqr(const block_t * const block, const_float_t target_velocity_sqr) {
+      return TERN(PLANNER_FIXED_POINT,
+        target_velocity_sqr + block->accel_speed_sqr,
+        max_allowable_speed_sqr(-block->acceleration, target_velocity_sqr, block->millimeters)
+      );
+    }
+
     #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
       /**
        * Calculate the speed reached given initial speed, acceleration and distance
@@ -1050,17 +1121,24 @@ class Planner {
       }
     #endif
 
+    #if DISABLED(PLANNER_FIXED_POINT) || ENABLED(MARLIN_TEST_BUILD)
+      static void calc_trapezoid_float(trapezoid_t &trap, const uint32_t step_event_count, const uint32_t nominal_rate, const uint32_t initial_rate, const uint32_t final_rate, const uint32_t accel);
+    #endif
+    #if ANY(PLANNER_FIXED_POINT, MARLIN_TEST_BUILD)
+      static void calc_trapezoid_fixed(trapezoid_t &trap, const uint32_t step_event_count, const uint32_t nominal_rate, const uint32_t initial_rate, const uint32_t final_rate, const uint32_t accel);
+    #endif
+
     static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
 
-    static void reverse_pass_kernel(block_t * const current, const block_t * const next OPTARG(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static bool reverse_pass_kernel(block_t * const current, const block_t * const next OPTARG(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr));
     static void forward_pass_kernel(const block_t * const previous, block_t * const current, uint8_t block_index);
 
-    static void reverse_pass(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
-    static void forward_pass();
+    static uint8_t reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr));
+    static void forward_pass(const uint8_t stable_index);
 
-    static void recalculate_trapezoids(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr));
 
-    static void recalculate(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr));
 
     #if HAS_JUNCTION_DEVIATION
 
@@ -31,16 +31,19 @@
 #if ENABLED(BEZIER_CURVE_SUPPORT)
 
 #include "planner.h"
+#include "planner_bezier.h"
 #include "motion.h"
 #include "temperature.h"
 
 #include "../MarlinCore.h"
 #include "../gcode/queue.h"
 
-// See the meaning in the documentation of cubic_b_spline().
-#define MIN_STEP 0.002f
-#define MAX_STEP 0.1f
-#define SIGMA 0.1f
+#ifndef BEZIER_TOLERANCE
+  #define BEZIER_TOLERANCE 0.01f
+#endif
+
+// Subdivide at most this many times, for up to 2^BEZIER_MAX_DEPTH segments per curve
+#define BEZIER_MAX_DEPTH 10
 
 // Compute the linear interpolation between two real numbers.
 static inline float interp(const_float_t a, const_float_t b, const_float_t t) { return (1 - t) * a + t * b; }
@@ -61,49 +64,97 @@ static inline float eval_bezier(const_float_t a, const_float_t b, const_float_t
 }
 
 /**
- * We approximate Euclidean distance with the sum of the coordinates
- * offset (so-called "norm 1"), which is quicker to compute.
+ * A cubic Bézier curve in the XY plane, with its first and second
+ * derivatives for the tangent at the ends of a span and the curvature.
  */
-static inline float dist1(const_float_t x1, const_float_t y1, const_float_t x2, const_float_t y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
+struct BezierXY {
+  xy_pos_t p0, p1, p2, p3;
+
+  xy_pos_t point(const_float_t t) const {
+    return { eval_bezier(p0.x, p1.x, p2.x, p3.x, t), eval_bezier(p0.y, p1.y, p2.y, p3.y, t) };
+  }
+
+  xy_pos_t velocity(const_float_t t) const {
+    const float s = 1 - t, a = 3 * sq(s), b = 6 * s * t, c = 3 * sq(t);
+    return { a * (p1.x - p0.x) + b * (p2.x - p1.x) + c * (p3.x - p2.x),
+             a * (p1.y - p0.y) + b * (p2.y - p1.y) + c * (p3.y - p2.y) };
+  }
+
+  xy_pos_t acceleration(const_float_t t) const {
+    const float s = 6 * (1 - t), u = 6 * t;
+    return { s * (p2.x - 2 * p1.x + p0.x) + u * (p3.x - 2 * p2.x + p1.x),
+             s * (p2.y - 2 * p1.y + p0.y) + u * (p3.y - 2 * p2.y + p1.y) };
+  }
+
+  // Radius of curvature at t, or 0 where the curve is straight or stationary
+  float radius(const_float_t t) const {
+    const xy_pos_t v = velocity(t), a = acceleration(t);
+    const float cross = ABS(v.x * a.y - v.y * a.x), speed = v.magnitude();
+    return cross > 1e-6f ? speed * speed * speed / cross : 0;
+  }
+};
 
 /**
- * The algorithm for computing the step is loosely based on the one in Kig
- * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
- * However, we do not use the stack.
+ * Flatten a curve into chords no farther than a tolerance from the curve.
  *
- * The algorithm goes as it follows: the parameters t runs from 0.0 to
- * 1.0 describing the curve, which is evaluated by eval_bezier(). At
- * each iteration we have to choose a step, i.e., the increment of the
- * t variable. By default the step of the previous iteration is taken,
- * and then it is enlarged or reduced depending on how straight the
- * curve locally is. The step is always clamped between MIN_STEP/2 and
- * 2*MAX_STEP. MAX_STEP is taken at the first iteration.
+ * This is adaptive De Casteljau subdivision walked in order and without a stack.
+ * Spans of t are dyadic: each step tries the longest span that starts at the
+ * current t and is aligned to its own length, halving it until it is flat enough.
  *
- * For some t, the step value is considered acceptable if the curve in
- * the interval [t, t+step] is sufficiently straight, i.e.,
- * sufficiently close to linear interpolation. In practice the
- * following test is performed: the distance between eval_bezier(...,
- * t+step/2) is evaluated and compared with 0.5*(eval_bezier(...,
- * t)+eval_bezier(..., t+step)). If it is smaller than SIGMA, then the
- * step value is considered acceptable, otherwise it is not. The code
- * seeks to find the larger step value which is considered acceptable.
- *
- * At every iteration the recorded step value is considered and then
- * iteratively halved until it becomes acceptable. If it was already
- * acceptable in the beginning (i.e., no halving were done), then
- * maybe it was necessary to enlarge it; then it is iteratively
- * doubled while it remains acceptable. The last acceptable value
- * found is taken, provided that it is between MIN_STEP and MAX_STEP
- * and does not bring t over 1.0.
+ * The control points of the span [a, b] are P(a), P(a) + h/3 P'(a), P(b) - h/3 P'(b)
+ * and P(b), with h = b - a. The span is flat when
+ *   max(ux^2, vx^2) + max(uy^2, vy^2) <= 16 tol^2
+ * with u = 3 c1 - 2 c0 - c3 and v = 3 c2 - c0 - 2 c3, which bounds the distance
+ * between the curve and the chord by tol.
+ */
+class BezierFlattener {
+  const BezierXY &curve;
+  const float flat_limit;   // 16 tol^2
+  uint16_t index;           // Start of the next span, in units of the smallest span
+  uint8_t depth;            // Subdivision depth to try first for the next span
+  xy_pos_t pos, vel;        // Point and derivative at the start of the next span
+
+public:
+  BezierFlattener(const BezierXY &c, const_float_t tol) : curve(c), flat_limit(16 * sq(tol)), index(0), depth(0), pos(c.p0), vel(c.velocity(0)) {}
+
+  bool done() const { return index >= _BV(BEZIER_MAX_DEPTH); }
+
+  // Advance over the next flat span, giving its end point. Return t at the end of the span.
+  float next(xy_pos_t &end) {
+    constexpr float t_unit = 1.0f / _BV(BEZIER_MAX_DEPTH);
+    float t;
+    xy_pos_t p, v;
+    for (;;) {
+      const uint16_t span = _BV(BEZIER_MAX_DEPTH - depth);
+      const float h = span * t_unit;
+      t = (index + span) * t_unit;
+      p = curve.point(t);
+      v = curve.velocity(t);
+      if (depth == BEZIER_MAX_DEPTH) break;
+      const xy_pos_t u = pos + vel * h - p, w = p - v * h - pos;
+      if (_MAX(sq(u.x), sq(w.x)) + _MAX(sq(u.y), sq(w.y)) <= flat_limit) break;
+      ++depth;
+    }
+    index += _BV(BEZIER_MAX_DEPTH - depth);
+    pos = p;
+    vel = v;
+    end = p;
+
+    // Next time try the longest span that starts here
+    while (depth && !(index & (_BV(BEZIER_MAX_DEPTH - depth + 1) - 1))) --depth;
+
+    return t;
+  }
+};
+
+/**
+ * Buffer a G5 curve as flattened chords.
  *
- * Caveat: this algorithm is not perfect, since it can happen that a
- * step is considered acceptable even when the curve is not linear at
- * all in the interval [t, t+step] (but its mid point coincides "by
- * chance" with the midpoint according to the parametrization). This
- * kind of glitches can be eliminated with proper first derivative
- * estimates; however, given the improbability of such configurations,
- * the mitigation offered by MIN_STEP and the small computational
- * power available on Arduino, I think it is not wise to implement it.
+ * A first pass measures the flattened length and the smallest radius of curvature
+ * at the chord junctions. The second pass buffers the chords, interpolating the
+ * other axes by distance along the curve. It gives the planner the radius of the
+ * curve at each junction, and a safe exit speed from which it can still stop by
+ * the end of the curve and take the sharpest junction ahead.
  */
 void cubic_b_spline(
   const xyze_pos_t &position,       // current position
@@ -113,18 +164,36 @@ void cubic_b_spline(
   const uint8_t extruder
 ) {
   // Absolute first and second control points are recovered.
-  const xy_pos_t first = position + offsets[0], second = target + offsets[1];
+  const BezierXY curve = { position, position + offsets[0], target + offsets[1], target };
 
-  xyze_pos_t bez_target;
-  bez_target.set(position.x, position.y);
-  float step = MAX_STEP;
+  float total_mm = 0, min_radius = 0;
+  {
+    BezierFlattener flattener(curve, BEZIER_TOLERANCE);
+    xy_pos_t prev = curve.p0, end;
+    while (!flattener.done()) {
+      const float t = flattener.next(end), r = curve.radius(t);
+      total_mm += (end - prev).magnitude();
+      prev = end;
+      if (r && (!min_radius || r < min_radius)) min_radius = r;
+    }
+  }
+
+  // An exit speed which is <= the maximum XY speeds and the nominal speed, and which the
+  // sharpest junction can take without exceeding the XY accelerations.
+  const float limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[X_AXIS], planner.settings.max_acceleration_mm_per_s2[Y_AXIS]),
+              limiting_speed = _MIN(planner.settings.max_feedrate_mm_s[X_AXIS], planner.settings.max_feedrate_mm_s[Y_AXIS], scaled_fr_mm_s);
+  float limiting_speed_sqr = sq(limiting_speed);
+  if (min_radius) NOMORE(limiting_speed_sqr, limiting_accel * min_radius);
 
   millis_t next_idle_ms = millis() + 200UL;
 
   // Hints to help optimize the move
   PlannerHints hints;
 
-  for (float t = 0; t < 1;) {
+  BezierFlattener flattener(curve, BEZIER_TOLERANCE);
+  xy_pos_t prev = curve.p0;
+  float done_mm = 0;
+  while (!flattener.done()) {
 
     thermalManager.task();
     millis_t now = millis();
@@ -133,71 +202,29 @@ void cubic_b_spline(
       idle();
     }
 
-    // First try to reduce the step in order to make it sufficiently
-    // close to a linear interpolation.
-    bool did_reduce = false;
-    float new_t = t + step;
-    NOMORE(new_t, 1);
-    float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
-          new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
-    for (;;) {
-      if (new_t - t < (MIN_STEP)) break;
-      const float candidate_t = 0.5f * (t + new_t),
-                  candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + new_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + new_pos1);
-      if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-      did_reduce = true;
-    }
-
-    // If we did not reduce the step, maybe we should enlarge it.
-    if (!did_reduce) for (;;) {
-      if (new_t - t > MAX_STEP) break;
-      const float candidate_t = t + 2 * (new_t - t);
-      if (candidate_t >= 1) break;
-      const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
-      if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-    }
+    xy_pos_t end;
+    const float t = flattener.next(end);
+    done_mm += (end - prev).magnitude();
+    prev = end;
 
-    // Check some postcondition; they are disabled in the actual
-    // Marlin build, but if you test the same code on a computer you
-    // may want to check they are respect.
-    /*
-      assert(new_t <= 1.0);
-      if (new_t < 1.0) {
-        assert(new_t - t >= (MIN_STEP) / 2.0);
-        assert(new_t - t <= (MAX_STEP) * 2.0);
-      }
-    */
-
-    hints.millimeters = new_t - t;
-    t = new_t;
+    // Other axes move in proportion to the distance along the curve
+    const bool last = flattener.done();
+    const float f = (last || !total_mm) ? 1.0f : done_mm / total_mm;
 
     // Compute and send new position
-    xyze_pos_t new_bez = LOGICAL_AXIS_ARRAY(
-      interp(position.e, target.e, t),  // FIXME. Wrong, since t is not linear in the distance.
-      new_pos0,
-      new_pos1,
-      interp(position.z, target.z, t),  // FIXME. Wrong, since t is not linear in the distance.
-      interp(position.i, target.i, t),  // FIXME. Wrong, since t is not linear in the distance.
-      interp(position.j, target.j, t),  // FIXME. Wrong, since t is not linear in the distance.
-      interp(position.k, target.k, t),  // FIXME. Wrong, since t is not linear in the distance.
-      interp(position.u, target.u, t),  // FIXME. Wrong, since t is not linear in the distance.
-      interp(position.v, target.v, t),  // FIXME. Wrong, since t is not linear in the distance.
-      interp(position.w, target.w, t)   // FIXME. Wrong, since t is not linear in the distance.
+    xyze_pos_t bez_target = LOGICAL_AXIS_ARRAY(
+      interp(position.e, target.e, f),
+      end.x,
+      end.y,
+      interp(position.z, target.z, f),
+      interp(position.i, target.i, f),
+      interp(position.j, target.j, f),
+      interp(position.k, target.k, f),
+      interp(position.u, target.u, f),
+      interp(position.v, target.v, f),
+      interp(position.w, target.w, f)
     );
-    apply_motion_limits(new_bez);
-    bez_target = new_bez;
+    apply_motion_limits(bez_target);
 
     #if HAS_LEVELING && !PLANNER_LEVELING
       xyze_pos_t pos = bez_target;
@@ -206,9 +233,91 @@ void cubic_b_spline(
       const xyze_pos_t &pos = bez_target;
     #endif
 
+    hints.safe_exit_speed_sqr = last ? 0 : _MIN(limiting_speed_sqr, 2 * limiting_accel * (total_mm - done_mm));
+
     if (!planner.buffer_line(pos, scaled_fr_mm_s, active_extruder, hints))
       break;
+
+    // The next chord joins this one on the curve
+    hints.curve_radius = curve.radius(t);
   }
 }
 
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  /**
+   * Flatten reference curves with the adaptive subdivision and with the
+   * previous step controller, which halved or doubled a step in t until the
+   * Manhattan distance from the span midpoint to the chord midpoint was 0.1mm.
+   * Report the chord count and the largest distance from the curve to its chords.
+   */
+  void test_bezier_flattening() {
+    // Largest distance from the curve over [t0, t1] to the chord a-b
+    auto deviation = [](const BezierXY &c, const_float_t t0, const_float_t t1, const xy_pos_t &a, const xy_pos_t &b) {
+      const xy_pos_t ab = b - a;
+      const float len2 = sq(ab.x) + sq(ab.y);
+      float dmax = 0;
+      for (uint8_t i = 1; i < 16; ++i) {
+        const xy_pos_t p = c.point(t0 + (t1 - t0) * i / 16), ap = p - a;
+        const float k = len2 ? constrain((ap.x * ab.x + ap.y * ab.y) / len2, 0, 1) : 0;
+        NOLESS(dmax, (ap - ab * k).magnitude());
+      }
+      return dmax;
+    };
+
+    static const BezierXY curves[] = {
+      { {  0,  0 }, {   0, 30 }, { 30, 60 }, { 60, 60 } },    // Quarter-circle-like bend
+      { {  0,  0 }, { 100,  0 }, {-50, 50 }, { 50, 50 } },    // S-curve
+      { {  0,  0 }, {  50, 50 }, {  0, 50 }, { 50,  0 } },    // Loop with a tight turn
+      { {  0,  0 }, {  30, .5 }, { 60,-.5 }, { 90,  0 } },    // Nearly straight
+      { {  0,  0 }, {   2,  4 }, {  6,  4 }, {  8,  0 } }     // Small arch
+    };
+
+    bool pass = true;
+    for (uint8_t n = 0; n < COUNT(curves); ++n) {
+      const BezierXY &c = curves[n];
+
+      uint16_t segs = 0;
+      float dev = 0, t0 = 0;
+      xy_pos_t a = c.p0, b;
+      BezierFlattener flattener(c, BEZIER_TOLERANCE);
+      while (!flattener.done()) {
+        const float t1 = flattener.next(b);
+        NOLESS(dev, deviation(c, t0, t1, a, b));
+        a = b; t0 = t1; ++segs;
+      }
+
+      uint16_t old_segs = 0;
+      float old_dev = 0, step = 0.1f;
+      a = c.p0;
+      for (float t = 0; t < 1;) {
+        auto bent = [&](const_float_t t1, const xy_pos_t &p1) {
+          const xy_pos_t m = c.point(0.5f * (t + t1));
+          return ABS(m.x - 0.5f * (a.x + p1.x)) + ABS(m.y - 0.5f * (a.y + p1.y)) > 0.1f;
+        };
+        float t1 = _MIN(t + step, 1.0f);
+        b = c.point(t1);
+        bool reduced = false;
+        while (t1 - t >= 0.002f && bent(t1, b)) { t1 = 0.5f * (t + t1); b = c.point(t1); reduced = true; }
+        if (!reduced) while (t1 - t <= 0.1f && t + 2 * (t1 - t) < 1) {
+          const float t2 = t + 2 * (t1 - t);
+          const xy_pos_t p2 = c.point(t2);
+          if (bent(t2, p2)) break;
+          t1 = t2; b = p2;
+        }
+        step = t1 - t;
+        NOLESS(old_dev, deviation(c, t, t1, a, b));
+        a = b; t = t1; ++old_segs;
+      }
+
+      const bool ok = dev <= (BEZIER_TOLERANCE) * 1.01f;
+      pass &= ok;
+      SERIAL_ECHOLN(F("Bezier curve "), n, F(": adaptive "), segs, F(" chords, max dev "), p_float_t(dev, 4),
+                    F(" | previous "), old_segs, F(" chords, max dev "), p_float_t(old_dev, 4), ok ? F(" PASS") : F(" FAIL"));
+    }
+    SERIAL_ECHOLNPGM("Bezier flattening within ", p_float_t(BEZIER_TOLERANCE, 3), "mm: ", pass ? "PASS" : "FAIL");
+  }
+
+#endif // MARLIN_TEST_BUILD
+
 #endif // BEZIER_CURVE_SUPPORT
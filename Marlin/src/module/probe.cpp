@@ -107,6 +107,10 @@ Probe probe;
 
 xyz_pos_t Probe::offset; // Initialized by settings.load()
 
+#if ENABLED(PROBE_BUMP_SAMPLING)
+  Probe::sample_stats_t Probe::sample_stats;
+#endif
+
 #if HAS_PROBE_XY_OFFSET
   const xy_pos_t &Probe::offset_xy = Probe::offset;
 #endif
@@ -707,6 +711,101 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
   }
 #endif
 
+#if ENABLED(PROBE_BUMP_SAMPLING)
+
+  /**
+   * @brief Evaluate the samples taken at one point
+   *
+   * @details Set sample_stats with the median and standard deviation of all samples.
+   *
+   * @param probes The Z samples, sorted ascending
+   *
+   * @return The average of the MULTIPLE_PROBING samples nearest the median
+   */
+  float Probe::eval_samples(const float (&probes)[TOTAL_PROBING]) {
+    // Take the center value (or average the two middle values) as the median
+    static constexpr int PHALF = (TOTAL_PROBING - 1) / 2;
+    const float middle = probes[PHALF];
+    sample_stats.median = ((TOTAL_PROBING) & 1) ? middle : (middle + probes[PHALF + 1]) * 0.5f;
+
+    float sum = 0;
+    for (uint8_t i = 0; i < TOTAL_PROBING; ++i) sum += probes[i];
+    const float mean = sum * RECIPROCAL(TOTAL_PROBING);
+
+    float sum_of_diff_squared = 0;
+    for (uint8_t i = 0; i < TOTAL_PROBING; ++i) sum_of_diff_squared += sq(probes[i] - mean);
+    sample_stats.stddev = SQRT(sum_of_diff_squared * RECIPROCAL(TOTAL_PROBING));
+
+    #if EXTRA_PROBING > 0
+      // Remove values farthest from the median
+      uint8_t min_avg_idx = 0, max_avg_idx = TOTAL_PROBING - 1;
+      for (uint8_t i = EXTRA_PROBING; i--;)
+        if (ABS(probes[max_avg_idx] - sample_stats.median) > ABS(probes[min_avg_idx] - sample_stats.median))
+          max_avg_idx--; else min_avg_idx++;
+
+      // Return the average value of all remaining probes.
+      sum = 0;
+      for (uint8_t i = min_avg_idx; i <= max_avg_idx; ++i) sum += probes[i];
+      return sum * RECIPROCAL(MULTIPLE_PROBING);
+    #else
+      return mean;
+    #endif
+  }
+
+  /**
+   * @brief Find the bed with one fast probe, then take all samples at the slow speed,
+   *        raising only PROBE_BUMP_MM above the last trigger point between samples.
+   *
+   * @details If the samples spread more than PROBE_BUMP_MAX_STDDEV, take them again
+   *          with the full Z_CLEARANCE_MULTI_PROBE raise between samples.
+   *
+   * @param try_to_probe The probing function of run_z_probe
+   * @param z_probe_low_point The lowest Z to probe down to
+   * @param sanity_check Flag to fail on a probe triggered too high
+   *
+   * @return The measured Z, or NAN on error
+   */
+  template<typename TRY_PROBE>
+  float Probe::bump_sampling(TRY_PROBE &try_to_probe, const_float_t z_probe_low_point, const bool sanity_check) {
+    // Attempt to tare the probe
+    if (TERN0(PROBE_TARE, tare())) return NAN;
+
+    // Find the bed at the fast speed
+    if (try_to_probe(PSTR("FAST"), z_probe_low_point, z_probe_fast_mm_s, sanity_check)) return NAN;
+
+    float probes[TOTAL_PROBING], measured_z;
+    for (bool full_raise = false;; full_raise = true) {
+      const float raise = full_raise ? float(Z_CLEARANCE_MULTI_PROBE) : float(PROBE_BUMP_MM);
+      for (uint8_t p = 0; p < TOTAL_PROBING; ++p) {
+        do_z_clearance(current_position.z + raise, false);
+
+        // If the probe won't tare, return
+        if (TERN0(PROBE_TARE, tare())) return NAN;
+
+        if (try_to_probe(PSTR("SLOW"), z_probe_low_point, MMM_TO_MMS(Z_PROBE_FEEDRATE_SLOW), sanity_check)) return NAN;
+
+        TERN_(MEASURE_BACKLASH_WHEN_PROBING, backlash.measure_with_probe());
+
+        // Insert Z measurement into probes[]. Keep it sorted ascending.
+        const float z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+        uint8_t i = p;
+        for (; i && probes[i - 1] > z; --i) probes[i] = probes[i - 1];
+        probes[i] = z;
+      }
+
+      measured_z = eval_samples(probes);
+      sample_stats.full_raise = full_raise;
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Median: ", sample_stats.median, " StdDev: ", sample_stats.stddev);
+
+      if (full_raise || sample_stats.stddev <= (PROBE_BUMP_MAX_STDDEV)) break;
+
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Spread too large. Probing again with full raise.");
+    }
+    return measured_z;
+  }
+
+#endif // PROBE_BUMP_SAMPLING
+
 #if DISABLED(PROUI_EX)
   /**
    * @brief Probe at the current XY (possibly more than once) to find the bed Z.
@@ -757,6 +856,10 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
     const float z_probe_low_point = zoffs + z_min_point -float((!axis_is_trusted(Z_AXIS)) * 10);
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Probe Low Point: ", z_probe_low_point);
 
+    #if ENABLED(PROBE_BUMP_SAMPLING)
+      return DIFF_TERN(HAS_HOTEND_OFFSET, bump_sampling(try_to_probe, z_probe_low_point, sanity_check), hotend_offset[active_extruder].z);
+    #endif
+
     // Double-probing does a fast probe followed by a slow probe
     #if TOTAL_PROBING == 2
 
@@ -996,8 +1099,14 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
     else {
       TERN_(HAS_PTC, ptc.apply_compensation(measured_z));
       TERN_(X_AXIS_TWIST_COMPENSATION, measured_z += xatc.compensation(npos + offset_xy));
-      if (verbose_level > 2 || DEBUGGING(LEVELING))
-        SERIAL_ECHOLNPGM("Bed X: ", LOGICAL_X_POSITION(rx), " Y: ", LOGICAL_Y_POSITION(ry), " Z: ", measured_z);
+      if (verbose_level > 2 || DEBUGGING(LEVELING)) {
+        SERIAL_ECHOPGM("Bed X: ", LOGICAL_X_POSITION(rx), " Y: ", LOGICAL_Y_POSITION(ry), " Z: ", measured_z);
+        #if ENABLED(PROBE_BUMP_SAMPLING)
+          SERIAL_ECHOPGM(" Median: ", p_float_t(sample_stats.median, 3), " StdDev: ", p_float_t(sample_stats.stddev, 4));
+          if (sample_stats.full_raise) SERIAL_ECHOPGM(" (full raise)");
+        #endif
+        SERIAL_EOL();
+      }
     }
 
     return measured_z;
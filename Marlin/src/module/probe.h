@@ -87,6 +87,14 @@ public:
 
     static xyz_pos_t offset;
 
+    #if ENABLED(PROBE_BUMP_SAMPLING)
+      typedef struct {
+        float median, stddev;   // Of all samples at the last probed point
+        bool full_raise;        // Spread was too large with bumps, so sampled again with the full raise
+      } sample_stats_t;
+      static sample_stats_t sample_stats;
+    #endif
+
     #if ANY(PREHEAT_BEFORE_PROBING, PREHEAT_BEFORE_LEVELING)
       static void preheat_for_probing(const celsius_t hotend_temp, const celsius_t bed_temp, const bool early=false);
     #endif
@@ -357,6 +365,11 @@ public:
 
 private:
   static bool probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s);
+  #if ENABLED(PROBE_BUMP_SAMPLING)
+    static float eval_samples(const float (&probes)[TOTAL_PROBING]);
+    template<typename TRY_PROBE>
+    static float bump_sampling(TRY_PROBE &try_to_probe, const_float_t z_probe_low_point, const bool sanity_check);
+  #endif
   static float run_z_probe(const bool sanity_check=true, const_float_t z_min_point=Z_PROBE_LOW_POINT, const_float_t z_clearance=Z_TWEEN_SAFE_CLEARANCE);
 };
 
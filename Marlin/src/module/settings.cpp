@@ -666,6 +666,13 @@ typedef struct SettingsDataStruct {
           shaping_y_zeta;                               // M593 Y D
   #endif
 
+  //
+  // Arc chord tolerance
+  //
+  #if HAS_ARC_CHORD_TOLERANCE
+    float arc_tolerance_mm;                             // M214 T
+  #endif
+
   //
   // HOTEND_IDLE_TIMEOUT
   //
@@ -716,7 +723,9 @@ void MarlinSettings::postprocess() {
 
   TERN_(ENABLE_LEVELING_FADE_HEIGHT, set_z_fade_height(new_z_fade_height, false)); // false = no report
 
-  TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+  #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    bedlevel.refresh_bed_level();
+  #endif
 
   TERN_(HAS_MOTOR_CURRENT_PWM, stepper.refresh_motor_power());
 
@@ -836,6 +845,57 @@ void MarlinSettings::postprocess() {
   int MarlinSettings::eeprom_index;
   uint16_t MarlinSettings::working_crc;
 
+  #if ENABLED(EEPROM_STAGED_IO)
+
+    #ifndef EEPROM_STAGE_CHUNK
+      #define EEPROM_STAGE_CHUNK 256  // Bytes handed to the store per write
+    #endif
+
+    // RAM image of the stored settings, starting at EEPROM_OFFSET
+    static uint8_t stage[sizeof(SettingsData)];
+
+    /**
+     * Read the whole stored image with a single read
+     */
+    void MarlinSettings::stage_fetch() {
+      int pos = EEPROM_OFFSET;
+      uint16_t crc = 0;
+      persistentStore.read_data(pos, stage, sizeof(stage), &crc);
+    }
+
+    /**
+     * Store the image in chunks of up to EEPROM_STAGE_CHUNK bytes
+     * Return 'true' on write error
+     */
+    bool MarlinSettings::stage_commit(const uint16_t size) {
+      int pos = EEPROM_OFFSET;
+      uint16_t crc = 0;
+      for (uint16_t i = 0; i < size; i += EEPROM_STAGE_CHUNK)
+        if (persistentStore.write_data(pos, &stage[i], _MIN(size - i, uint16_t(EEPROM_STAGE_CHUNK)), &crc))
+          return true;
+      return false;
+    }
+
+    void MarlinSettings::stage_write(const uint8_t *value, const size_t size) {
+      const int i = eeprom_index - (EEPROM_OFFSET);
+      if (i >= 0 && i + size <= sizeof(stage)) memcpy(&stage[i], value, size);
+      crc16(&working_crc, value, size);
+      eeprom_index += size;
+    }
+
+    void MarlinSettings::stage_read(uint8_t *value, const size_t size, const bool writing/*=true*/) {
+      const int i = eeprom_index - (EEPROM_OFFSET);
+      if (i >= 0 && i + size <= sizeof(stage)) {
+        crc16(&working_crc, &stage[i], size);
+        if (writing) memcpy(value, &stage[i], size);
+        eeprom_index += size;
+      }
+      else
+        persistentStore.read_data(eeprom_index, value, size, &working_crc, writing);
+    }
+
+  #endif // EEPROM_STAGED_IO
+
   EEPROM_Error MarlinSettings::size_error(const uint16_t size) {
     if (size != datasize()) {
       DEBUG_ERROR_MSG("EEPROM datasize error."
@@ -1807,6 +1867,14 @@ void MarlinSettings::postprocess() {
       #endif
     #endif
 
+    //
+    // Arc chord tolerance
+    //
+    #if HAS_ARC_CHORD_TOLERANCE
+      _FIELD_TEST(arc_tolerance_mm);
+      EEPROM_WRITE(gcode.arc_tolerance_mm);
+    #endif
+
     //
     // HOTEND_IDLE_TIMEOUT
     //
@@ -1830,10 +1898,18 @@ void MarlinSettings::postprocess() {
       #endif
       EEPROM_WRITE(final_crc);
 
+      // Store the finished image, as long as it's complete
+      #if ENABLED(EEPROM_STAGED_IO)
+        if (eeprom_size == datasize() && stage_commit(eeprom_size)) {
+          DEBUG_ERROR_MSG("EEPROM write failed.");
+          eeprom_error = ERR_EEPROM_CORRUPT;
+        }
+      #endif
+
       // Report storage size
       DEBUG_ECHO_MSG("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)final_crc, ")");
 
-      eeprom_error = size_error(eeprom_size);
+      if (!eeprom_error) eeprom_error = size_error(eeprom_size);
     }
     EEPROM_FINISH();
 
@@ -1864,6 +1940,8 @@ void MarlinSettings::postprocess() {
 
     if (!EEPROM_START(EEPROM_OFFSET)) return eeprom_error;
 
+    TERN_(EEPROM_STAGED_IO, stage_fetch());
+
     char stored_ver[4];
     EEPROM_READ_ALWAYS(stored_ver);
 
@@ -2344,7 +2422,10 @@ void MarlinSettings::postprocess() {
         user_thermistor_t user_thermistor[USER_THERMISTORS];
         _FIELD_TEST(user_thermistor);
         EEPROM_READ(user_thermistor);
-        if (!validating) COPY(thermalManager.user_thermistor, user_thermistor);
+        if (!validating) {
+          COPY(thermalManager.user_thermistor, user_thermistor);
+          for (auto &t : thermalManager.user_thermistor) t.pre_calc = true; // Rebuild derived values
+        }
       }
       #endif
 
@@ -2928,6 +3009,14 @@ void MarlinSettings::postprocess() {
       }
       #endif
 
+      //
+      // Arc chord tolerance
+      //
+      #if HAS_ARC_CHORD_TOLERANCE
+        _FIELD_TEST(arc_tolerance_mm);
+        EEPROM_READ(gcode.arc_tolerance_mm);
+      #endif
+
       //
       // HOTEND_IDLE_TIMEOUT
       //
@@ -3166,6 +3255,8 @@ void MarlinSettings::postprocess() {
             bedlevel.set_mesh_from_store(z_mesh_store, bedlevel.z_values);
         #endif
 
+        if (!into) bedlevel.refresh_bed_level();
+
         #if ENABLED(DWIN_LCD_PROUI)
           status = !bedLevelTools.meshValidate();
           if (status) {
@@ -3789,6 +3880,11 @@ void MarlinSettings::reset() {
     #endif
   #endif
 
+  //
+  // Arc chord tolerance
+  //
+  TERN_(HAS_ARC_CHORD_TOLERANCE, gcode.arc_tolerance_mm = (ARC_CHORD_TOLERANCE) * 0.001f);
+
   //
   // Hotend Idle Timeout
   //
@@ -4059,6 +4155,11 @@ void MarlinSettings::reset() {
     //
     TERN_(HAS_ZV_SHAPING, gcode.M593_report(forReplay));
 
+    //
+    // Arc chord tolerance
+    //
+    TERN_(HAS_ARC_CHORD_TOLERANCE, gcode.M214_report(forReplay));
+
     //
     // Hotend Idle Timeout
     //
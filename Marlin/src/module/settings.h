@@ -131,24 +131,48 @@ class MarlinSettings {
       template<typename T>
       static void EEPROM_SKIP(const T &VAR) { eeprom_index += sizeof(VAR); }
 
-      template<typename T>
-      static void EEPROM_WRITE(const T &VAR) {
-        persistentStore.write_data(eeprom_index, (const uint8_t *) &VAR, sizeof(VAR), &working_crc);
-      }
+      #if ENABLED(EEPROM_STAGED_IO)
 
-      template<typename T>
-      static void EEPROM_READ_(T &VAR) {
-        persistentStore.read_data(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), &working_crc, !validating);
-      }
+        // Settings are built up in a RAM image and stored in one go, or
+        // fetched in one go and then read from the image.
+        static void stage_fetch();
+        static bool stage_commit(const uint16_t size);
+        static void stage_write(const uint8_t *value, const size_t size);
+        static void stage_read(uint8_t *value, const size_t size, const bool writing=true);
 
-      static void EEPROM_READ_(uint8_t *VAR, size_t sizeof_VAR) {
-        persistentStore.read_data(eeprom_index, VAR, sizeof_VAR, &working_crc, !validating);
-      }
+        template<typename T>
+        static void EEPROM_WRITE(const T &VAR) { stage_write((const uint8_t *) &VAR, sizeof(VAR)); }
 
-      template<typename T>
-      static void EEPROM_READ_ALWAYS_(T &VAR) {
-        persistentStore.read_data(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), &working_crc);
-      }
+        template<typename T>
+        static void EEPROM_READ_(T &VAR) { stage_read((uint8_t *) &VAR, sizeof(VAR), !validating); }
+
+        static void EEPROM_READ_(uint8_t *VAR, size_t sizeof_VAR) { stage_read(VAR, sizeof_VAR, !validating); }
+
+        template<typename T>
+        static void EEPROM_READ_ALWAYS_(T &VAR) { stage_read((uint8_t *) &VAR, sizeof(VAR)); }
+
+      #else
+
+        template<typename T>
+        static void EEPROM_WRITE(const T &VAR) {
+          persistentStore.write_data(eeprom_index, (const uint8_t *) &VAR, sizeof(VAR), &working_crc);
+        }
+
+        template<typename T>
+        static void EEPROM_READ_(T &VAR) {
+          persistentStore.read_data(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), &working_crc, !validating);
+        }
+
+        static void EEPROM_READ_(uint8_t *VAR, size_t sizeof_VAR) {
+          persistentStore.read_data(eeprom_index, VAR, sizeof_VAR, &working_crc, !validating);
+        }
+
+        template<typename T>
+        static void EEPROM_READ_ALWAYS_(T &VAR) {
+          persistentStore.read_data(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), &working_crc);
+        }
+
+      #endif
 
     #endif // EEPROM_SETTINGS
 };
@@ -222,6 +222,13 @@ uint32_t Stepper::advance_divisor = 0,
          Stepper::decelerate_after,          // The count at which to start decelerating
          Stepper::step_event_count;          // The total event count for the current block
 
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  uint16_t Stepper::arc_chords_left; // = 0
+  uint32_t Stepper::arc_chord_events;
+  xy_float_t Stepper::arc_rvec, Stepper::arc_center;
+  xy_long_t Stepper::arc_pos, Stepper::arc_end;
+#endif
+
 #if ANY(HAS_MULTI_EXTRUDER, MIXING_EXTRUDER)
   uint8_t Stepper::stepper_extruder;
 #else
@@ -642,6 +649,72 @@ void Stepper::apply_directions() {
   DIR_WAIT_AFTER();
 }
 
+#if ENABLED(ARC_NATIVE_BLOCKS)
+
+  /**
+   * Set up the Bresenham tracer for the next chord of an arc block.
+   * Rotate the radius vector by one chord angle and round the new chord end to whole steps.
+   * The last chord ends exactly where the planner put the end of the block.
+   *
+   * All chords have the same number of step events, so the plane axis dividends are scaled
+   * by the chord count to work against the divisor for the whole block.
+   */
+  void Stepper::next_arc_chord() {
+    const block_arc_t &arc = current_block->arc;
+    const AxisEnum p = arc.axis_p, q = arc.axis_q;
+
+    xy_long_t target;
+    if (--arc_chords_left) {
+      arc_rvec.set(arc_rvec.x * arc.cos_T - arc_rvec.y * arc.sin_T,
+                   arc_rvec.x * arc.sin_T + arc_rvec.y * arc.cos_T);
+      target.set(LROUND(arc_center.x + arc_rvec.x * planner.settings.axis_steps_per_mm[p]),
+                 LROUND(arc_center.y + arc_rvec.y * planner.settings.axis_steps_per_mm[q]));
+    }
+    else
+      target = arc_end;
+
+    const int32_t dp = target.x - arc_pos.x, dq = target.y - arc_pos.y;
+    arc_pos = target;
+
+    advance_dividend[p] = ABS(dp) * 2 * arc.chords;
+    advance_dividend[q] = ABS(dq) * 2 * arc.chords;
+    delta_error[p] = delta_error[q] = -int32_t(step_event_count);
+
+    if (dp > 0) current_block->direction_bits.bset(p); else if (dp < 0) current_block->direction_bits.bclr(p);
+    if (dq > 0) current_block->direction_bits.bset(q); else if (dq < 0) current_block->direction_bits.bclr(q);
+
+    arc_chord_events = step_event_count / arc.chords;
+  }
+
+  /**
+   * Apply the plane axis directions of a new chord. Only these two DIR pins are set,
+   * so the E direction reversed by Linear Advance is left as it is.
+   */
+  void Stepper::apply_arc_directions() {
+    const AxisBits &dir = current_block->direction_bits;
+    const AxisEnum plane[] = { current_block->arc.axis_p, current_block->arc.axis_q };
+    if (dir[plane[0]] == last_direction_bits[plane[0]] && dir[plane[1]] == last_direction_bits[plane[1]]) return;
+
+    DIR_WAIT_BEFORE();
+
+    for (const AxisEnum axis : plane) {
+      if (dir[axis] == last_direction_bits[axis]) continue;
+      last_direction_bits.toggle(axis);
+      switch (axis) {
+        case X_AXIS: SET_STEP_DIR(X); break;
+        case Y_AXIS: SET_STEP_DIR(Y); break;
+        #if HAS_Z_AXIS
+          case Z_AXIS: SET_STEP_DIR(Z); break;
+        #endif
+        default: break;
+      }
+    }
+
+    DIR_WAIT_AFTER();
+  }
+
+#endif // ARC_NATIVE_BLOCKS
+
 #if ENABLED(S_CURVE_ACCELERATION)
   /**
    *  This uses a quintic (fifth-degree) Bézier polynomial for the velocity curve, giving
@@ -1526,11 +1599,18 @@ void Stepper::isr() {
               fxdTiCtrl.sts_stepperBusy = true;
 
               // "Pop" one command from the command buffer.
-              fxdTiCtrl_stepCmd = fxdTiCtrl.stepperCmdBuff[fxdTiCtrl.stepperCmdBuff_consumeIdx];
-              const uint8_t dir_index = fxdTiCtrl.stepperCmdBuff_consumeIdx >> 3,
-                            dir_bit = fxdTiCtrl.stepperCmdBuff_consumeIdx & 0x7;
-              fxdTiCtrl_applyDir = TEST(fxdTiCtrl.stepperCmdBuff_ApplyDir[dir_index], dir_bit);
-              nextMainISR = fxdTiCtrl.stepperCmdBuff_StepRelativeTi[fxdTiCtrl.stepperCmdBuff_consumeIdx];
+              #if ENABLED(FTM_COMPACT_BUFFERS)
+                const ft_packed_cmd_t packed = fxdTiCtrl.stepperCmdBuff[fxdTiCtrl.stepperCmdBuff_consumeIdx];
+                fxdTiCtrl_stepCmd = ft_command_t(packed >> (FT_PACKED_CMD_SHIFT));
+                fxdTiCtrl_applyDir = TEST32(packed, FT_PACKED_BIT_APPLY_DIR);
+                nextMainISR = packed & (FT_PACKED_TICKS_MAX);
+              #else
+                fxdTiCtrl_stepCmd = fxdTiCtrl.stepperCmdBuff[fxdTiCtrl.stepperCmdBuff_consumeIdx];
+                const uint8_t dir_index = fxdTiCtrl.stepperCmdBuff_consumeIdx >> 3,
+                              dir_bit = fxdTiCtrl.stepperCmdBuff_consumeIdx & 0x7;
+                fxdTiCtrl_applyDir = TEST(fxdTiCtrl.stepperCmdBuff_ApplyDir[dir_index], dir_bit);
+                nextMainISR = fxdTiCtrl.stepperCmdBuff_StepRelativeTi[fxdTiCtrl.stepperCmdBuff_consumeIdx];
+              #endif
               fxdTiCtrl_stepCmdRdy = true;
 
               if (++fxdTiCtrl.stepperCmdBuff_consumeIdx == (FTM_STEPPERCMD_BUFF_SIZE))
@@ -1945,6 +2025,17 @@ void Stepper::pulse_phase_isr() {
     #endif // DIRECT_STEPPING
 
     if (!is_page) {
+      #if ENABLED(ARC_NATIVE_BLOCKS)
+        // Start the next chord of an arc when the current one has used up its step events
+        if (arc_chords_left) {
+          if (!arc_chord_events) {
+            next_arc_chord();
+            apply_arc_directions();
+          }
+          --arc_chord_events;
+        }
+      #endif
+
       // Give the compiler a clue to store advance_divisor in registers for what follows
       const uint32_t advance_divisor_cached = advance_divisor;
 
@@ -2665,6 +2756,22 @@ hal_timer_t Stepper::block_phase_isr() {
       advance_dividend = (current_block->steps << 1).asLong();
       advance_divisor = step_event_count << 1;
 
+      #if ENABLED(ARC_NATIVE_BLOCKS)
+        // Set up the plane axes for the first chord of an arc
+        if (current_block->is_arc()) {
+          const block_arc_t &arc = current_block->arc;
+          arc_pos.set(count_position[arc.axis_p], count_position[arc.axis_q]);
+          arc_end = arc_pos + arc.delta;
+          arc_rvec = arc.rvec;
+          arc_center.set(arc_pos.x - arc.rvec.x * planner.settings.axis_steps_per_mm[arc.axis_p],
+                         arc_pos.y - arc.rvec.y * planner.settings.axis_steps_per_mm[arc.axis_q]);
+          arc_chords_left = arc.chords;
+          next_arc_chord();
+        }
+        else
+          arc_chords_left = 0;
+      #endif
+
       #if ENABLED(INPUT_SHAPING_X)
         if (shaping_x.enabled) {
           const int64_t steps = current_block->direction_bits.x ? int64_t(current_block->steps.x) : -int64_t(current_block->steps.x);
@@ -379,6 +379,15 @@ class Stepper {
                     decelerate_after,       // The point from where we need to start decelerating
                     step_event_count;       // The total event count for the current block
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      static uint16_t arc_chords_left;        // Chords still to start in the current arc block. Zero for a linear block.
+      static uint32_t arc_chord_events;       // Step events left in the current chord
+      static xy_float_t arc_rvec,             // (mm) Vector from the arc center to the end of the current chord
+                        arc_center;           // (steps) Arc center in the plane axes
+      static xy_long_t arc_pos,               // (steps) Plane axes position at the end of the current chord
+                       arc_end;               // (steps) Plane axes position at the end of the arc
+    #endif
+
     #if ANY(HAS_MULTI_EXTRUDER, MIXING_EXTRUDER)
       static uint8_t stepper_extruder;
     #else
@@ -673,6 +682,11 @@ class Stepper {
       static void microstep_init();
     #endif
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      static void next_arc_chord();
+      static void apply_arc_directions();
+    #endif
+
     #if ENABLED(FT_MOTION)
       static void fxdTiCtrl_stepper(const bool applyDir, const ft_command_t command);
       static void fxdTiCtrl_refreshAxisDidMove();
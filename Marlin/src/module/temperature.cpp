@@ -204,6 +204,10 @@
   #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
   static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
   static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  #ifdef THERMISTOR_LUT_STEP
+    #define NEXT_TEMPLUT(N) ,TT_LUT(TEMPTABLE_##N, TEMPTABLE_##N##_LEN)
+    static const uint8_t* heater_lut_map[HOTENDS] = ARRAY_BY_HOTENDS(TT_LUT(TEMPTABLE_0, TEMPTABLE_0_LEN) REPEAT_S(1, HOTENDS, NEXT_TEMPLUT));
+  #endif
 #endif
 
 Temperature thermalManager;
@@ -2180,6 +2184,58 @@ void Temperature::task() {
   }                                                                       \
 }while(0)
 
+/**
+ * Convert with the build-time segment index, if enabled
+ */
+#ifdef THERMISTOR_LUT_STEP
+  #define CONVERT_THERMISTOR_TABLE(TBL,LEN) return thermistor_lut_to_celsius(TBL, LEN, TT_LUT(TBL, LEN), raw)
+#else
+  #define CONVERT_THERMISTOR_TABLE SCAN_THERMISTOR_TABLE
+#endif
+
+#if ENABLED(MARLIN_TEST_BUILD) && defined(THERMISTOR_LUT_STEP)
+
+  static celsius_float_t scan_thermistor_table(const temp_entry_t * const tbl, const uint8_t len, const raw_adc_t raw) {
+    SCAN_THERMISTOR_TABLE(tbl, len);
+  }
+
+  // Compare the indexed conversion with the bisection for every raw value
+  static void test_thermistor_table(FSTR_P const name, const temp_entry_t * const tbl, const uint8_t len, const uint8_t * const lut) {
+    if (!lut) return;
+    float max_err = 0;
+    for (uint32_t raw = 0; raw <= MAX_RAW_THERMISTOR_VALUE; ++raw) {
+      const float err = ABS(thermistor_lut_to_celsius(tbl, len, lut, raw_adc_t(raw)) - scan_thermistor_table(tbl, len, raw_adc_t(raw)));
+      NOLESS(max_err, err);
+    }
+    SERIAL_ECHOLN(F("Thermistor LUT "), name, F(" max error "), p_float_t(max_err, 4), max_err < 0.001f ? F(" PASS") : F(" FAIL"));
+  }
+
+  void Temperature::test_thermistor_lut() {
+    #if HAS_HOTEND_THERMISTOR
+      HOTEND_LOOP() test_thermistor_table(F("E"), heater_ttbl_map[e], heater_ttbllen_map[e], heater_lut_map[e]);
+    #endif
+    #if TEMP_SENSOR_BED_IS_THERMISTOR
+      test_thermistor_table(F("BED"), TEMPTABLE_BED, TEMPTABLE_BED_LEN, TT_LUT(TEMPTABLE_BED, TEMPTABLE_BED_LEN));
+    #endif
+    #if TEMP_SENSOR_CHAMBER_IS_THERMISTOR
+      test_thermistor_table(F("CHAMBER"), TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN, TT_LUT(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN));
+    #endif
+    #if TEMP_SENSOR_COOLER_IS_THERMISTOR
+      test_thermistor_table(F("COOLER"), TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN, TT_LUT(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN));
+    #endif
+    #if TEMP_SENSOR_PROBE_IS_THERMISTOR
+      test_thermistor_table(F("PROBE"), TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN, TT_LUT(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN));
+    #endif
+    #if TEMP_SENSOR_BOARD_IS_THERMISTOR
+      test_thermistor_table(F("BOARD"), TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN, TT_LUT(TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN));
+    #endif
+    #if TEMP_SENSOR_REDUNDANT_IS_THERMISTOR
+      test_thermistor_table(F("REDUNDANT"), TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN, TT_LUT(TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN));
+    #endif
+  }
+
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -2262,20 +2318,8 @@ void Temperature::task() {
     );
   }
 
-  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
-
-    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
-
-    user_thermistor_t &t = user_thermistor[t_index];
-    if (t.pre_calc) { // pre-calculate some variables
-      t.pre_calc     = false;
-      t.res_25_recip = 1.0f / t.res_25;
-      t.res_25_log   = logf(t.res_25);
-      t.beta_recip   = 1.0f / t.beta;
-      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
-                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
-    }
-
+  // Evaluate the Beta / Steinhart-Hart equation for a raw reading
+  static float user_thermistor_calc(const user_thermistor_t &t, const raw_adc_t raw) {
     // Maximum ADC value .. take into account the over sampling
     constexpr raw_adc_t adc_max = MAX_RAW_THERMISTOR_VALUE;
     const raw_adc_t adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
@@ -2293,6 +2337,39 @@ void Temperature::task() {
     // Return degrees C (up to 999, as the LCD only displays 3 digits)
     return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
   }
+
+  #ifdef USER_THERMISTOR_LUT_STEP
+    // One entry every USER_THERMISTOR_LUT_STEP raw units, in 1/16 °C
+    constexpr uint16_t user_lut_size = (uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1) / (USER_THERMISTOR_LUT_STEP) + 1;
+    static int16_t user_thermistor_lut[USER_THERMISTORS][user_lut_size];
+  #endif
+
+  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
+
+    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
+
+    user_thermistor_t &t = user_thermistor[t_index];
+    if (t.pre_calc) { // pre-calculate some variables
+      t.pre_calc     = false;
+      t.res_25_recip = 1.0f / t.res_25;
+      t.res_25_log   = logf(t.res_25);
+      t.beta_recip   = 1.0f / t.beta;
+      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
+                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+      #ifdef USER_THERMISTOR_LUT_STEP
+        for (uint16_t i = 0; i < user_lut_size; ++i)
+          user_thermistor_lut[t_index][i] = LROUND(user_thermistor_calc(t, raw_adc_t(_MIN(uint32_t(i) * (USER_THERMISTOR_LUT_STEP), uint32_t(MAX_RAW_THERMISTOR_VALUE)))) * 16);
+      #endif
+    }
+
+    #ifdef USER_THERMISTOR_LUT_STEP
+      const int16_t * const lut = &user_thermistor_lut[t_index][raw / (USER_THERMISTOR_LUT_STEP)];
+      const int32_t frac = raw % (USER_THERMISTOR_LUT_STEP);
+      return (lut[0] + (lut[1] - lut[0]) * frac / (USER_THERMISTOR_LUT_STEP)) * (1.0f / 16);
+    #else
+      return user_thermistor_calc(t, raw);
+    #endif
+  }
 #endif
 
 #if HAS_HOTEND
@@ -2420,8 +2497,12 @@ void Temperature::task() {
 
     #if HAS_HOTEND_THERMISTOR
       // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #ifdef THERMISTOR_LUT_STEP
+        return thermistor_lut_to_celsius(heater_ttbl_map[e], heater_ttbllen_map[e], heater_lut_map[e], raw);
+      #else
+        const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+        SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #endif
     #endif
 
     return 0;
@@ -2434,7 +2515,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_BED_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_BED, raw);
     #elif TEMP_SENSOR_BED_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
+      CONVERT_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
     #elif TEMP_SENSOR_BED_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BED_IS_AD8495
@@ -2452,7 +2533,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_CHAMBER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif TEMP_SENSOR_CHAMBER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
+      CONVERT_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
     #elif TEMP_SENSOR_CHAMBER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_CHAMBER_IS_AD8495
@@ -2470,7 +2551,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_COOLER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_COOLER, raw);
     #elif TEMP_SENSOR_COOLER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN);
+      CONVERT_THERMISTOR_TABLE(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN);
     #elif TEMP_SENSOR_COOLER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_COOLER_IS_AD8495
@@ -2488,7 +2569,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_PROBE_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif TEMP_SENSOR_PROBE_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN);
+      CONVERT_THERMISTOR_TABLE(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN);
     #elif TEMP_SENSOR_PROBE_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_PROBE_IS_AD8495
@@ -2506,7 +2587,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_BOARD_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_BOARD, raw);
     #elif TEMP_SENSOR_BOARD_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN);
+      CONVERT_THERMISTOR_TABLE(TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN);
     #elif TEMP_SENSOR_BOARD_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BOARD_IS_AD8495
@@ -2544,7 +2625,7 @@ void Temperature::task() {
     #elif TEMP_SENSOR_IS_MAX_TC(REDUNDANT) && REDUNDANT_TEMP_MATCH(SOURCE, E2)
       return TERN(TEMP_SENSOR_REDUNDANT_IS_MAX31865, max31865_2.temperature(raw), (int16_t)raw * 0.25);
     #elif TEMP_SENSOR_REDUNDANT_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN);
+      CONVERT_THERMISTOR_TABLE(TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD8495
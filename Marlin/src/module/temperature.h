@@ -825,6 +825,7 @@ class Temperature {
         //if (!WITHIN(t_index, 0, USER_THERMISTORS - 1)) return false;
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].series_res = value;
+        user_thermistor[t_index].pre_calc = true;
         return true;
       }
       static bool set_res25(int8_t t_index, float value) {
@@ -872,6 +873,10 @@ class Temperature {
       static celsius_float_t analog_to_celsius_redundant(const raw_adc_t raw);
     #endif
 
+    #if ENABLED(MARLIN_TEST_BUILD) && defined(THERMISTOR_LUT_STEP)
+      static void test_thermistor_lut();
+    #endif
+
     #if HAS_FAN
 
       static uint8_t fan_speed[FAN_COUNT];
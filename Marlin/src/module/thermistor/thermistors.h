@@ -327,6 +327,56 @@ typedef struct { raw_adc_t value; celsius_t celsius; } temp_entry_t;
   #define TEMPTABLE_REDUNDANT_LEN 0
 #endif
 
+#ifdef THERMISTOR_LUT_STEP
+
+  /**
+   * Segment index for each THERMISTOR_LUT_STEP raw units, built at compile time.
+   * A lookup starts at the segment holding the start of the step and only has to
+   * walk past the table points that fall inside the step, instead of bisecting.
+   * The table's own interpolation is kept so results are the same as the bisection.
+   */
+  constexpr uint16_t THERMISTOR_LUT_SIZE = (uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1) / (THERMISTOR_LUT_STEP);
+
+  typedef struct { uint8_t seg[THERMISTOR_LUT_SIZE]; } thermistor_lut_t;
+
+  // Index of the first table point at or above 'raw', limited to the last point
+  constexpr uint8_t thermistor_table_segment(const temp_entry_t * const tbl, const uint8_t len, const raw_adc_t raw) {
+    uint8_t i = 0;
+    while (i < len - 1 && raw > tbl[i].value) ++i;
+    return i;
+  }
+
+  constexpr thermistor_lut_t index_thermistor_table(const temp_entry_t * const tbl, const uint8_t len) {
+    thermistor_lut_t lut{};
+    for (uint16_t i = 0; i < THERMISTOR_LUT_SIZE; ++i)
+      lut.seg[i] = thermistor_table_segment(tbl, len, raw_adc_t(uint32_t(i) * (THERMISTOR_LUT_STEP)));
+    return lut;
+  }
+
+  // One instance per table, shared by all sensors using it
+  template<const temp_entry_t *TBL, uint8_t LEN>
+  constexpr thermistor_lut_t thermistor_lut PROGMEM = index_thermistor_table(TBL, LEN);
+
+  // The index for a stock table, or nullptr for none or the Custom placeholder
+  template<const temp_entry_t *TBL, uint8_t LEN, bool = (LEN > 1)>
+  struct thermistor_lut_ref { static constexpr const uint8_t* ptr() { return thermistor_lut<TBL, LEN>.seg; } };
+  template<const temp_entry_t *TBL, uint8_t LEN>
+  struct thermistor_lut_ref<TBL, LEN, false> { static constexpr const uint8_t* ptr() { return nullptr; } };
+  #define TT_LUT(TBL,LEN) (thermistor_lut_ref<TBL, LEN>::ptr())
+
+  inline float thermistor_lut_to_celsius(const temp_entry_t * const tbl, const uint8_t len, const uint8_t * const lut, const raw_adc_t raw) {
+    uint8_t i = pgm_read_byte(&lut[raw / (THERMISTOR_LUT_STEP)]);
+    raw_adc_t v10 = pgm_read_word(&tbl[i].value);
+    while (raw > v10 && i < len - 1) v10 = pgm_read_word(&tbl[++i].value);
+    if (i == 0 || raw > v10) return celsius_t(pgm_read_word(&tbl[i].celsius)); // Outside of the table
+    const raw_adc_t v00 = pgm_read_word(&tbl[i - 1].value);
+    const celsius_t v01 = celsius_t(pgm_read_word(&tbl[i - 1].celsius)),
+                    v11 = celsius_t(pgm_read_word(&tbl[i].celsius));
+    return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);
+  }
+
+#endif // THERMISTOR_LUT_STEP
+
 // The SCAN_THERMISTOR_TABLE macro needs alteration?
 static_assert(255 > TEMPTABLE_0_LEN || 255 > TEMPTABLE_1_LEN || 255 > TEMPTABLE_2_LEN || 255 > TEMPTABLE_3_LEN
            || 255 > TEMPTABLE_4_LEN || 255 > TEMPTABLE_5_LEN || 255 > TEMPTABLE_6_LEN || 255 > TEMPTABLE_7_LEN
@@ -146,6 +146,23 @@ MediaFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if SD_READAHEAD_SIZE
+  uint8_t CardReader::rbuf[SD_READAHEAD_SIZE];
+  uint16_t CardReader::rbuf_pos, CardReader::rbuf_len;
+
+  /**
+   * Refill the read-ahead buffer from the current file position.
+   * The first read after a seek stops at the next sector boundary
+   * so later refills are whole, aligned sectors.
+   */
+  bool CardReader::fillReadAhead() {
+    const int16_t n = file.read(rbuf, SD_READAHEAD_SIZE - (file.curPosition() & 0x1FF));
+    rbuf_pos = 0;
+    rbuf_len = _MAX(n, 0);
+    return n > 0;
+  }
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -582,6 +599,10 @@ void CardReader::release() {
   else
     endFilePrintNow();
 
+  #ifdef POWER_LOSS_JOURNAL_SLOTS
+    if (recovery.file.isOpen()) recovery.close();  // Don't write a stale journal to another card
+  #endif
+
   flag.mounted = false;
   flag.workDirIsRoot = true;
   nrItems = -1;
@@ -622,6 +643,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(DWIN_CREALITY_LCD, hmiFlag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
   if (isFileOpen()) file.close();
+  resetReadAhead();
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -730,6 +752,7 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    resetReadAhead();
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -766,6 +789,7 @@ void CardReader::openFileWrite(const char * const path) {
 
   #if DISABLED(SDCARD_READONLY)
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
+      resetReadAhead();
       flag.saving = true;
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
@@ -980,6 +1004,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  resetReadAhead();
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -1434,7 +1459,12 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    #ifdef POWER_LOSS_JOURNAL_SLOTS
+      constexpr uint8_t write_flags = O_CREAT | O_RDWR | O_SYNC;  // Keep the journal slots
+    #else
+      constexpr uint8_t write_flags = O_CREAT | O_WRITE | O_TRUNC | O_SYNC;
+    #endif
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : write_flags))
       openFailed(recovery.filename);
     else if (!read)
       echo_write_to_file(recovery.filename);
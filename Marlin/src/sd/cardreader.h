@@ -232,10 +232,21 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #if SD_READAHEAD_SIZE
+    static int16_t get() {
+      if (rbuf_pos >= rbuf_len && !fillReadAhead()) return -1;
+      ++sdpos;
+      return rbuf[rbuf_pos++];
+    }
+    static int16_t read(void *buf, uint16_t nbyte)  { syncReadAhead(); return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static int16_t write(void *buf, uint16_t nbyte) { syncReadAhead(); return file.isOpen() ? file.write(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { resetReadAhead(); file.seekSet((sdpos = index)); }
+  #else
+    static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+    static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #endif
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -328,6 +339,20 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  //
+  // Read-ahead buffer for the file being printed.
+  // The file position runs ahead of sdpos by the unread part of the buffer.
+  //
+  #if SD_READAHEAD_SIZE
+    static uint8_t rbuf[SD_READAHEAD_SIZE];
+    static uint16_t rbuf_pos, rbuf_len;
+    static bool fillReadAhead();
+    static void resetReadAhead() { rbuf_pos = rbuf_len = 0; }
+    static void syncReadAhead() { if (rbuf_pos < rbuf_len) file.seekSet(sdpos); resetReadAhead(); }
+  #else
+    static void resetReadAhead() {}
+  #endif
+
   //
   // Procedure calls to other files
   //
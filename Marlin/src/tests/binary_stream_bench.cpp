@@ -0,0 +1,259 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Binary file transfer throughput benchmark
+ *
+ * Push a few MB of generated G-code through BinaryStream::receive() as a host
+ * would send it, once raw and once heatshrink-encoded, and report the effective
+ * upload rate along with the number of whole and partial sector writes.
+ * A round trip of highly repeated data checks that back-references decode to
+ * the original bytes.
+ *
+ * The transfer is opened as a dummy, so only protocol and decoding work is timed.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ALL(MARLIN_TEST_BUILD, BINARY_FILE_TRANSFER) && defined(__PLAT_NATIVE_SIM__)
+
+#include "marlin_tests.h"
+
+#include "../sd/cardreader.h"
+#include "../feature/binary_stream.h"
+
+#define BENCH_FILE_SIZE   (2UL * 1024 * 1024)
+#define REPEAT_FILE_SIZE  (64UL * 1024)
+#define BENCH_PAYLOAD     1024  // Packet payload, as offered by the receive buffer
+
+static char rx_buffer[BENCH_PAYLOAD];
+
+// File content, generated up front
+static struct {
+  uint8_t *data;
+  uint32_t len;
+
+  void append(const char *str, const uint16_t count) { memcpy(&data[len], str, count); len += count; }
+} input;
+
+// Generated G-code text
+static void make_gcode() {
+  char line[48];
+  input.len = 0;
+  for (uint32_t n = 0; input.len < BENCH_FILE_SIZE; ++n)
+    input.append(line, sprintf(line, "G1 X%u.%03u Y%u.%03u E%u.%04u\n",
+      unsigned(100 + (n * 7) % 90), unsigned((n * 131) % 1000),
+      unsigned(100 + (n * 11) % 90), unsigned((n * 257) % 1000),
+      unsigned(n / 300), unsigned((n * 33) % 10000)));
+}
+
+// Repeated lines and runs of one byte, which copy from just behind themselves
+static void make_repeated() {
+  char line[48];
+  input.len = 0;
+  for (uint32_t n = 0; input.len < REPEAT_FILE_SIZE; ++n) {
+    for (uint8_t i = n % 4; i--;) input.append("G1 X10 Y10 E0.5\n", 16);
+    memset(line, '0' + n % 10, n % 40 + 1);
+    input.append(line, n % 40 + 1);
+    input.append(line, sprintf(line, "\nG0 Z%u\n", unsigned(n % 7)));
+  }
+}
+
+// Greedy heatshrink encoder, using the decoder's default window and lookahead
+static struct {
+  uint8_t *data;
+  uint32_t len, backrefs;
+  uint16_t bits;
+  uint8_t nbits;
+
+  void put(const uint16_t value, const uint8_t count) {
+    for (uint8_t b = count; b--;) {
+      bits = (bits << 1) | ((value >> b) & 1);
+      if (++nbits == 8) { data[len++] = bits; bits = nbits = 0; }
+    }
+  }
+
+  void encode() {
+    constexpr uint32_t window = _BV(HEATSHRINK_STATIC_WINDOW_BITS), lookahead = _BV(HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+    uint32_t * const last = new uint32_t[0x10000](); // Last position + 1 of each byte pair
+    len = backrefs = bits = nbits = 0;
+    for (uint32_t i = 0; i < input.len;) {
+      // Longest match at the last position of the same two bytes
+      uint32_t from = 0, count = 0;
+      if (i + 1 < input.len) {
+        const uint32_t prev = last[input.data[i] << 8 | input.data[i + 1]];
+        if (prev && i - (prev - 1) <= window) {
+          from = prev - 1;
+          while (count < lookahead && i + count < input.len && input.data[from + count] == input.data[i + count]) ++count;
+        }
+      }
+      if (count >= 2) {
+        put(0, 1);
+        put(i - from - 1, HEATSHRINK_STATIC_WINDOW_BITS);
+        put(count - 1, HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+        ++backrefs;
+      }
+      else {
+        put(1, 1);
+        put(input.data[i], 8);
+        count = 1;
+      }
+      for (; count--; ++i)
+        if (i + 1 < input.len) last[input.data[i] << 8 | input.data[i + 1]] = i + 1;
+    }
+    if (nbits) put(0, 8 - nbits); // Pad the final byte
+    delete[] last;
+  }
+} encoder;
+
+// Packets as the host builds them, see MarlinBinaryProtocol.py
+static struct {
+  uint8_t data[8 + BENCH_PAYLOAD + 2];
+  uint16_t len;
+  uint8_t sync, stage;  // 0:open 1:write 2:close 3:done
+  bool compress;
+  const uint8_t *src;
+  uint32_t src_len, src_index;
+
+  static uint16_t fletcher(uint16_t cs, const uint8_t value) {
+    const uint16_t cs_low = ((cs & 0xFF) + value) % 255;
+    return ((((cs >> 8) + cs_low) % 255) << 8) | cs_low;
+  }
+
+  void reset(const bool c) {
+    len = 0; sync = stage = 0; compress = c;
+    src = c ? encoder.data : input.data;
+    src_len = c ? encoder.len : input.len;
+    src_index = 0;
+  }
+
+  void build() {
+    uint16_t size = 0;
+    uint8_t type;
+    uint8_t * const payload = &data[8];
+    switch (stage) {
+      case 0:
+        type = 1; // OPEN: dummy, compression, filename
+        payload[size++] = 1;
+        payload[size++] = compress;
+        for (const char *s = "bench.gco"; *s; ++s) payload[size++] = *s;
+        payload[size++] = '\0';
+        stage = 1;
+        break;
+      case 1:
+        type = 3; // WRITE
+        size = _MIN(src_len - src_index, uint32_t(BENCH_PAYLOAD));
+        memcpy(payload, &src[src_index], size);
+        src_index += size;
+        if (src_index == src_len) stage = 2;
+        break;
+      default:
+        type = 2; // CLOSE
+        stage = 3;
+        break;
+    }
+
+    data[0] = 0xAD; data[1] = 0xB5;
+    data[2] = sync++;
+    data[3] = (1 << 4) | type; // FILE_TRANSFER protocol
+    data[4] = size & 0xFF; data[5] = size >> 8;
+    uint16_t cs = 0;
+    for (uint8_t i = 2; i < 6; ++i) cs = fletcher(cs, data[i]);
+    data[6] = cs & 0xFF; data[7] = cs >> 8;
+    len = 8;
+    if (size) {
+      cs = fletcher(cs, data[6]);
+      cs = fletcher(cs, data[7]);
+      for (uint16_t i = 0; i < size; ++i) cs = fletcher(cs, payload[i]);
+      len += size;
+      data[len++] = cs & 0xFF;
+      data[len++] = cs >> 8;
+    }
+  }
+} packets;
+
+// The whole upload, generated up front so only the receiving end is timed
+static struct {
+  uint8_t *data;
+  uint32_t len, index;
+} upload;
+
+static const bs_test_source_t bench_source = {
+  []{ return upload.index < upload.len; },
+  []{ return upload.index < upload.len ? int(upload.data[upload.index++]) : -1; }
+};
+
+static void run_bench(FSTR_P const name, const bool compress) {
+  packets.reset(compress);
+  upload.data = new uint8_t[packets.src_len + packets.src_len / 64 + 1024];
+  upload.len = upload.index = 0;
+  while (packets.stage != 3) {
+    packets.build();
+    memcpy(&upload.data[upload.len], packets.data, packets.len);
+    upload.len += packets.len;
+  }
+
+  BinaryStream stream;
+  stream.reset();
+  bs_test_source = &bench_source;
+  const uint32_t start_us = micros();
+  while (upload.index < upload.len) stream.receive(rx_buffer);
+  stream.receive(rx_buffer);  // Finish off the last packet
+  const uint32_t elapsed_us = _MAX(micros() - start_us, 1UL);
+  bs_test_source = nullptr;
+  delete[] upload.data;
+
+  // The card must get the input back, in whole sectors but for the last
+  uint16_t input_crc = 0;
+  crc16(&input_crc, input.data, input.len);
+  const uint32_t expect_sectors = input.len / 512, expect_partial = (input.len % 512) ? 1 : 0;
+  const bool pass = SDFileTransferProtocol::sector_writes == expect_sectors
+                 && SDFileTransferProtocol::partial_writes == expect_partial
+                 && SDFileTransferProtocol::written_crc == input_crc;
+
+  SERIAL_ECHOLN(
+    F("Binary transfer "), name, F(": "), input.len, F(" bytes from "), upload.len, F(" sent ("),
+    uint32_t(compress ? encoder.backrefs : 0), F(" back-references), "),
+    elapsed_us / 1000, F(" ms, "), uint32_t(input.len * 1000000ULL / 1024 / elapsed_us), F(" KB/s, "),
+    SDFileTransferProtocol::sector_writes, F(" sector + "), SDFileTransferProtocol::partial_writes,
+    F(" partial writes "), pass ? F("PASS") : F("FAIL")
+  );
+}
+
+void runBinaryStreamBenchmarks() {
+  input.data = new uint8_t[BENCH_FILE_SIZE + 64];
+  make_gcode();
+  run_bench(F("raw"), false);
+  #if ENABLED(BINARY_STREAM_COMPRESSION)
+    encoder.data = new uint8_t[input.len * 9 / 8 + 2];
+    encoder.encode();
+    run_bench(F("heatshrink"), true);
+
+    make_repeated();
+    encoder.encode();
+    run_bench(F("heatshrink repeated"), true);
+    delete[] encoder.data;
+  #endif
+  delete[] input.data;
+}
+
+#endif // MARLIN_TEST_BUILD && BINARY_FILE_TRANSFER && __PLAT_NATIVE_SIM__
@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * CRC16 throughput benchmark
+ *
+ * Checksum a settings-sized image the way the EEPROM backends do, one byte
+ * per call, and in one block. Compare the table update with the bitwise
+ * reference it replaced.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(MARLIN_TEST_BUILD) && defined(__PLAT_NATIVE_SIM__)
+
+#include "marlin_tests.h"
+
+#include "../MarlinCore.h"
+#include "../libs/crc16.h"
+
+#define BENCH_IMAGE_SIZE  4096  // A large settings image, e.g., with several UBL mesh slots
+#define BENCH_PASSES      256
+
+typedef void (*crc16_fn_t)(uint16_t *crc, const void * const data, uint16_t cnt);
+
+static uint8_t image[BENCH_IMAGE_SIZE];
+
+static uint16_t run_bench(FSTR_P const name, const crc16_fn_t fn, const bool per_byte) {
+  uint16_t crc = 0;
+  const uint32_t start_us = micros();
+  for (uint16_t p = 0; p < BENCH_PASSES; ++p) {
+    if (per_byte)
+      for (uint16_t i = 0; i < BENCH_IMAGE_SIZE; ++i) fn(&crc, &image[i], 1);
+    else
+      fn(&crc, image, BENCH_IMAGE_SIZE);
+  }
+  const uint32_t elapsed_us = _MAX(micros() - start_us, 1UL);
+
+  SERIAL_ECHOLN(
+    F("CRC16 bench "), name, F(": "), p_float_t(float(elapsed_us) / BENCH_PASSES, 1), F(" us per "),
+    BENCH_IMAGE_SIZE, F(" bytes, "), uint32_t(uint64_t(BENCH_IMAGE_SIZE) * BENCH_PASSES * 1000000ULL / 1024 / elapsed_us), F(" KB/s")
+  );
+  return crc;
+}
+
+void runCRC16Benchmarks() {
+  for (uint16_t i = 0; i < BENCH_IMAGE_SIZE; ++i) image[i] = uint8_t(i * 167 + (i >> 7));
+
+  const uint16_t ref = run_bench(F("bitwise per byte"), crc16_bitwise, true);
+  const bool pass = run_bench(F("table per byte"), crc16, true) == ref
+                 && run_bench(F("table block"), crc16, false) == ref;
+  SERIAL_ECHOLNPGM("CRC16 bench results match: ", pass ? "PASS" : "FAIL");
+}
+
+#endif // MARLIN_TEST_BUILD && __PLAT_NATIVE_SIM__
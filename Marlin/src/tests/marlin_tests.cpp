@@ -24,9 +24,19 @@
 
 #if ENABLED(MARLIN_TEST_BUILD)
 
+#include "marlin_tests.h"
+
+#include "../HAL/shared/eeprom_api.h"
+#include "../libs/crc16.h"
 #include "../module/endstops.h"
+#if ENABLED(FT_MOTION)
+  #include "../module/ft_motion.h"
+#endif
 #include "../module/motion.h"
 #include "../module/planner.h"
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #include "../module/planner_bezier.h"
+#endif
 #include "../module/settings.h"
 #include "../module/stepper.h"
 #include "../module/temperature.h"
@@ -72,6 +82,29 @@ void runStartupTests() {
   auto print_char_ptr = [](char * const str) { SERIAL_ECHOLN(str); };
   print_char_ptr(str);
 
+  planner.test_trapezoid();
+
+  #ifdef THERMISTOR_LUT_STEP
+    thermalManager.test_thermistor_lut();
+  #endif
+
+  TERN_(FT_MOTION, fxdTiCtrl.test_kernels());
+
+  TERN_(BEZIER_CURVE_SUPPORT, test_bezier_flattening());
+
+  test_crc16();
+
+  #if ALL(FLASH_EEPROM_EMULATION, FLASH_EEPROM_LOG)
+    test_flash_eeprom_log();
+  #endif
+
+  #ifdef __PLAT_NATIVE_SIM__
+    runPlannerBenchmarks();
+    runCRC16Benchmarks();
+    TERN_(EEPROM_SETTINGS, runSettingsBenchmarks());
+    TERN_(BINARY_FILE_TRANSFER, runBinaryStreamBenchmarks());
+  #endif
+
 }
 
 // Periodic tests are run from within loop()
@@ -23,3 +23,14 @@
 
 void runStartupTests();
 void runPeriodicTests();
+
+#ifdef __PLAT_NATIVE_SIM__
+  void runPlannerBenchmarks();
+  void runCRC16Benchmarks();
+  #if ENABLED(EEPROM_SETTINGS)
+    void runSettingsBenchmarks();
+  #endif
+  #if ENABLED(BINARY_FILE_TRANSFER)
+    void runBinaryStreamBenchmarks();
+  #endif
+#endif
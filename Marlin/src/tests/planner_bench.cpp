@@ -0,0 +1,124 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Planner throughput benchmarks
+ *
+ * Feed synthetic G-code streams through GCodeQueue, GcodeSuite and Planner,
+ * reporting the blocks planned per second of processing, the time per block,
+ * and how often the planner ran dry while commands were still waiting.
+ *
+ * The moves are really executed, so this only runs in the simulator.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(MARLIN_TEST_BUILD) && defined(__PLAT_NATIVE_SIM__)
+
+#include "marlin_tests.h"
+
+#include "../MarlinCore.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+
+typedef MString<MAX_CMD_SIZE> bench_cmd_t;
+typedef void (*bench_gen_t)(bench_cmd_t &cmd, const uint16_t n);
+
+// Tiny extruding segments around a 10mm circle, as in a sliced perimeter
+static void arc_segments_gen(bench_cmd_t &cmd, const uint16_t n) {
+  const float a = RADIANS(1.2f) * n; // ~0.2mm chords
+  cmd.set(F("G1 X"), p_float_t(X_CENTER + 10 * cos(a), 3), F(" Y"), p_float_t(Y_CENTER + 10 * sin(a), 3),
+          F(" E"), p_float_t(0.01f * n, 4), F(" F3000"));
+}
+
+// Long travel moves between the corners of an 80mm square
+static void travel_gen(bench_cmd_t &cmd, const uint16_t n) {
+  cmd.set(F("G0 X"), X_CENTER + ((n & 1) ? 40 : -40), F(" Y"), Y_CENTER + ((n & 2) ? 40 : -40), F(" F9000"));
+}
+
+// Moves of mixed length with extrusion and the occasional retract
+static void mixed_gen(bench_cmd_t &cmd, const uint16_t n) {
+  static float e;
+  if (!n) e = 0;
+  if (n % 16 == 15)
+    cmd.set(F("G1 E"), p_float_t(e - 0.8f, 4), F(" F2400"));   // Retract, recovered by the next move
+  else {
+    const uint8_t len = 1 + (n * 37) % 20;                      // 1 to 20mm
+    e += 0.033f * len;
+    cmd.set(F("G1 X"), X_CENTER + ((n & 1) ? len : -len), F(" Y"), Y_CENTER + ((n & 2) ? len : -len),
+            F(" E"), p_float_t(e, 4), F(" F4800"));
+  }
+}
+
+static void run_bench(FSTR_P const name, const bench_gen_t gen, const uint16_t count) {
+  planner.synchronize();
+  planner.kernel_stats = {};
+
+  bench_cmd_t cmd;
+  uint32_t busy_us = 0;
+  uint16_t underruns = 0;
+  for (uint16_t n = 0; n < count; ++n) {
+    // Wait for room outside of the timed section, as the main loop would
+    while (planner.moves_free() < (BLOCK_BUFFER_SIZE) / 2) idle();
+
+    // Planner ran out of moves while there was more to do?
+    if (n && !planner.has_blocks_queued()) ++underruns;
+
+    gen(cmd, n);
+    queue.inject(cmd);
+
+    const uint32_t start_us = micros();
+    queue.advance();
+    busy_us += micros() - start_us;
+  }
+  planner.synchronize();
+
+  const uint32_t blocks = planner.kernel_stats.blocks;
+  NOLESS(busy_us, 1UL);
+  SERIAL_ECHOLN(
+    F("Planner bench "), name, F(": "), count, F(" commands, "), blocks, F(" blocks, "),
+    uint32_t(blocks * 1000000ULL / busy_us), F(" blocks/s, "),
+    p_float_t(blocks ? float(busy_us) / blocks : 0.0f, 2), F(" us/block, "),
+    underruns, F(" underruns")
+  );
+  planner.report_kernel_stats();
+}
+
+void runPlannerBenchmarks() {
+  #if ENABLED(PREVENT_COLD_EXTRUSION)
+    const bool old_allow_cold_extrude = thermalManager.allow_cold_extrude;
+    thermalManager.allow_cold_extrude = true;
+  #endif
+
+  queue.inject(F("G28\nG92 E0"));
+  while (queue.has_commands_queued()) queue.advance();
+
+  run_bench(F("arc segments"), arc_segments_gen, 600);
+  run_bench(F("travel"), travel_gen, 24);
+  run_bench(F("mixed"), mixed_gen, 240);
+
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = old_allow_cold_extrude);
+}
+
+#endif // MARLIN_TEST_BUILD && __PLAT_NATIVE_SIM__
@@ -0,0 +1,59 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Settings storage benchmark
+ *
+ * Time the boot-time read of the settings (validate, which reads and checks
+ * everything without applying it) against the configured persistent store.
+ * Nothing is written, so settings and the UI are left alone. Build with and
+ * without EEPROM_STAGED_IO to compare.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ALL(MARLIN_TEST_BUILD, EEPROM_SETTINGS) && defined(__PLAT_NATIVE_SIM__)
+
+#include "marlin_tests.h"
+
+#include "../MarlinCore.h"
+#include "../module/settings.h"
+
+#define BENCH_PASSES 10
+
+static void run_bench(FSTR_P const name, bool (*fn)()) {
+  bool ok = true;
+  const uint32_t start_us = micros();
+  for (uint8_t p = 0; p < BENCH_PASSES; ++p) ok &= fn();
+  const uint32_t elapsed_us = micros() - start_us;
+
+  SERIAL_ECHOLN(
+    F("Settings bench "), name, F(": "), p_float_t(elapsed_us / 1000.0f / BENCH_PASSES, 2), F(" ms for "),
+    settings.datasize(), F(" bytes"), TERN(EEPROM_STAGED_IO, F(" staged"), F("")), ok ? F(" PASS") : F(" FAIL")
+  );
+}
+
+void runSettingsBenchmarks() {
+  run_bench(F("validate"), MarlinSettings::validate);
+}
+
+#endif // MARLIN_TEST_BUILD && EEPROM_SETTINGS && __PLAT_NATIVE_SIM__
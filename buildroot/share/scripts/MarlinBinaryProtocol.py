@@ -329,8 +329,10 @@ class FileTransferProtocol(object):
 
         return self.responses.popleft()
 
-    def connect(self):
-        self.protocol.send(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.QUERY);
+    def connect(self, window = 15, lookahead = 4):
+        # Request heatshrink settings; the firmware replies with the closest it supports
+        payload = self.protocol.pack_int8(window) + self.protocol.pack_int8(lookahead)
+        self.protocol.send(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.QUERY, payload);
 
         token, data = self.await_response()
         if token != 'PFT:version:':